@@ -0,0 +1,4 @@
+BENCH_LIST = $(sort $(patsubst %/bench.mk,%, $(shell find $(ROOT_DIR)tests/bench -type f -name bench.mk 2>/dev/null)))
+
+# Benchmarks built like unit tests, from the _SRC and _DEFS of their name
+include $(QUANTUM_PATH)/debounce/tests/benchlist.mk
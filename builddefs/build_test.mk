@@ -53,7 +53,10 @@ ifneq ($(strip $(DEBUG)), 0)
 CONSOLE_ENABLE = yes
 endif
 
-ifneq ($(filter $(FULL_TESTS),$(TEST)),)
+ifeq ($(strip $(BENCH)), yes)
+include tests/test_common/build.mk
+include $(TEST_PATH)/bench.mk
+else ifneq ($(filter $(FULL_TESTS),$(TEST)),)
 include tests/test_common/build.mk
 include $(TEST_PATH)/test.mk
 endif
@@ -64,14 +67,18 @@ include $(PLATFORM_PATH)/common.mk
 include $(TMK_PATH)/protocol.mk
 include $(QUANTUM_PATH)/debounce/tests/rules.mk
 include $(QUANTUM_PATH)/encoder/tests/rules.mk
+include $(QUANTUM_PATH)/matrix_wakeup/tests/rules.mk
 include $(QUANTUM_PATH)/os_detection/tests/rules.mk
 include $(QUANTUM_PATH)/sequencer/tests/rules.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/rules.mk
 include $(QUANTUM_PATH)/logging/print.mk
 include $(PLATFORM_PATH)/test/rules.mk
-ifneq ($(filter $(FULL_TESTS),$(TEST)),)
+ifneq ($(filter $(FULL_TESTS),$(TEST))$(filter yes,$(strip $(BENCH))),)
 include $(BUILDDEFS_PATH)/build_full_test.mk
 endif
+ifeq ($(strip $(BENCH)), yes)
+$(TEST_OUTPUT)_SRC += tests/test_common/trace_replay.cpp
+endif
 
 $(TEST_OUTPUT)_SRC += \
 	tests/test_common/main.cpp \
@@ -40,6 +40,16 @@ else
     include $(PLATFORM_PATH)/$(PLATFORM_KEY)/printf.mk
 endif
 
+ifeq ($(strip $(TASK_PROFILER_ENABLE)), yes)
+    OPT_DEFS += -DTASK_PROFILER_ENABLE
+    QUANTUM_SRC += $(QUANTUM_DIR)/task_profiler.c
+endif
+
+ifeq ($(strip $(KEY_LATENCY_ENABLE)), yes)
+    OPT_DEFS += -DKEY_LATENCY_ENABLE
+    QUANTUM_SRC += $(QUANTUM_DIR)/key_latency.c
+endif
+
 ifeq ($(strip $(DEBUG_MATRIX_SCAN_RATE_ENABLE)), yes)
     OPT_DEFS += -DDEBUG_MATRIX_SCAN_RATE
     CONSOLE_ENABLE = yes
@@ -585,6 +595,14 @@ ifneq ($(strip $(VARIABLE_TRACE)),no)
     endif
 endif
 
+ifeq ($(strip $(MATRIX_WAKEUP_ENABLE)), yes)
+    OPT_DEFS += -DMATRIX_WAKEUP_ENABLE
+    QUANTUM_SRC += $(QUANTUM_DIR)/matrix_wakeup.c
+    ifneq ("$(wildcard $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_wakeup.c)","")
+        SRC += $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_wakeup.c
+    endif
+endif
+
 ifeq ($(strip $(SLEEP_LED_ENABLE)), yes)
     SRC += $(PLATFORM_COMMON_DIR)/sleep_led.c
     OPT_DEFS += -DSLEEP_LED_ENABLE
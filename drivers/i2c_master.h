@@ -138,4 +138,18 @@ i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* dat
  */
 i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout);
 
+#if defined(I2C_BYTE_COUNTER_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief Get the number of bytes clocked onto the bus since startup or the last reset, including address and register bytes.
+ * Only available when `I2C_BYTE_COUNTER_ENABLE` is defined.
+ * \return The number of bytes transferred.
+ */
+uint32_t i2c_get_bytes_transferred(void);
+
+/**
+ * \brief Reset the count returned by i2c_get_bytes_transferred() to zero.
+ */
+void i2c_reset_bytes_transferred(void);
+#endif
+
 /** \} */
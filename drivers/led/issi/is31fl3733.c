@@ -23,6 +23,7 @@
 #include "wait.h"
 
 #define IS31FL3733_PWM_REGISTER_COUNT 192
+#define IS31FL3733_PWM_CHUNK(reg) ((uint16_t)1 << ((reg) / 16))
 #define IS31FL3733_LED_CONTROL_REGISTER_COUNT 24
 
 #ifndef IS31FL3733_I2C_TIMEOUT
@@ -95,15 +96,15 @@ const uint8_t driver_sync[IS31FL3733_DRIVER_COUNT] = {
 // buffers and the transfers in is31fl3733_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3733_driver_t {
-    uint8_t pwm_buffer[IS31FL3733_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t led_control_buffer[IS31FL3733_LED_CONTROL_REGISTER_COUNT];
-    bool    led_control_buffer_dirty;
+    uint8_t  pwm_buffer[IS31FL3733_PWM_REGISTER_COUNT];
+    uint16_t pwm_buffer_dirty;
+    uint8_t  led_control_buffer[IS31FL3733_LED_CONTROL_REGISTER_COUNT];
+    bool     led_control_buffer_dirty;
 } PACKED is31fl3733_driver_t;
 
 is31fl3733_driver_t driver_buffers[IS31FL3733_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = 0,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
@@ -127,8 +128,13 @@ void is31fl3733_write_pwm_buffer(uint8_t index) {
     // Assumes page 1 is already selected.
     // Transmit PWM registers in 12 transfers of 16 bytes.
 
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
+    // Iterate over the pwm_buffer contents at 16 byte intervals,
+    // skipping any that have not changed since the last update.
     for (uint8_t i = 0; i < IS31FL3733_PWM_REGISTER_COUNT; i += 16) {
+        if (!(driver_buffers[index].pwm_buffer_dirty & IS31FL3733_PWM_CHUNK(i))) {
+            continue;
+        }
+
 #if IS31FL3733_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3733_I2C_PERSISTENCE; j++) {
             if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3733_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
@@ -211,7 +217,7 @@ void is31fl3733_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         driver_buffers[led.driver].pwm_buffer[led.r] = red;
         driver_buffers[led.driver].pwm_buffer[led.g] = green;
         driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= IS31FL3733_PWM_CHUNK(led.r) | IS31FL3733_PWM_CHUNK(led.g) | IS31FL3733_PWM_CHUNK(led.b);
     }
 }
 
@@ -257,7 +263,7 @@ void is31fl3733_update_pwm_buffers(uint8_t index) {
 
         is31fl3733_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
@@ -27,6 +27,11 @@
 #define IS31FL3741_SCALING_0_REGISTER_COUNT 180
 #define IS31FL3741_SCALING_1_REGISTER_COUNT 171
 
+// One dirty bit per PWM transfer: bits 0-5 cover page 0, bits 6-14 page 1.
+#define IS31FL3741_PWM_CHUNK(reg) ((uint16_t)1 << (((reg) & 0x100) ? 6 + ((reg) & 0xFF) / 19 : (reg) / 30))
+#define IS31FL3741_PWM_0_DIRTY_MASK 0x003F
+#define IS31FL3741_PWM_1_DIRTY_MASK 0x7FC0
+
 #ifndef IS31FL3741_I2C_TIMEOUT
 #    define IS31FL3741_I2C_TIMEOUT 100
 #endif
@@ -75,18 +80,18 @@ const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
 // buffers and the transfers in is31fl3741_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3741_driver_t {
-    uint8_t pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
-    uint8_t pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
-    uint8_t scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
-    bool    scaling_buffer_dirty;
+    uint8_t  pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
+    uint8_t  pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
+    uint16_t pwm_buffer_dirty;
+    uint8_t  scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
+    uint8_t  scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
+    bool     scaling_buffer_dirty;
 } PACKED is31fl3741_driver_t;
 
 is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
     .pwm_buffer_0         = {0},
     .pwm_buffer_1         = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = 0,
     .scaling_buffer_0     = {0},
     .scaling_buffer_1     = {0},
     .scaling_buffer_dirty = false,
@@ -108,12 +113,21 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
 }
 
 void is31fl3741_write_pwm_buffer(uint8_t index) {
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+    uint16_t dirty = driver_buffers[index].pwm_buffer_dirty;
+
+    if (dirty & IS31FL3741_PWM_0_DIRTY_MASK) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+    }
 
     // Transmit PWM0 registers in 6 transfers of 30 bytes.
 
-    // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
+    // Iterate over the pwm_buffer_0 contents at 30 byte intervals,
+    // skipping any that have not changed since the last update.
     for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
+        if (!(dirty & IS31FL3741_PWM_CHUNK(i))) {
+            continue;
+        }
+
 #if IS31FL3741_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
             if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
@@ -123,12 +137,19 @@ void is31fl3741_write_pwm_buffer(uint8_t index) {
 #endif
     }
 
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
+    if (dirty & IS31FL3741_PWM_1_DIRTY_MASK) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
+    }
 
     // Transmit PWM1 registers in 9 transfers of 19 bytes.
 
-    // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
+    // Iterate over the pwm_buffer_1 contents at 19 byte intervals,
+    // skipping any that have not changed since the last update.
     for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
+        if (!(dirty & IS31FL3741_PWM_CHUNK(0x100 | i))) {
+            continue;
+        }
+
 #if IS31FL3741_I2C_PERSISTENCE > 0
         for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
             if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
@@ -214,7 +235,7 @@ void is31fl3741_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         set_pwm_value(led.driver, led.r, red);
         set_pwm_value(led.driver, led.g, green);
         set_pwm_value(led.driver, led.b, blue);
-        driver_buffers[led.driver].pwm_buffer_dirty = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= IS31FL3741_PWM_CHUNK(led.r) | IS31FL3741_PWM_CHUNK(led.g) | IS31FL3741_PWM_CHUNK(led.b);
     }
 }
 
@@ -247,7 +268,7 @@ void is31fl3741_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
         is31fl3741_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
@@ -255,7 +276,7 @@ void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t red, uint8_
     set_pwm_value(pled->driver, pled->r, red);
     set_pwm_value(pled->driver, pled->g, green);
     set_pwm_value(pled->driver, pled->b, blue);
-    driver_buffers[pled->driver].pwm_buffer_dirty = true;
+    driver_buffers[pled->driver].pwm_buffer_dirty |= IS31FL3741_PWM_CHUNK(pled->r) | IS31FL3741_PWM_CHUNK(pled->g) | IS31FL3741_PWM_CHUNK(pled->b);
 }
 
 void is31fl3741_update_led_control_registers(uint8_t index) {
@@ -24,6 +24,7 @@
 #include "wait.h"
 
 #define IS31FL3742A_PWM_REGISTER_COUNT 180
+#define IS31FL3742A_PWM_CHUNK(reg) ((uint16_t)1 << ((reg) / 30))
 #define IS31FL3742A_SCALING_REGISTER_COUNT 180
 
 #ifndef IS31FL3742A_I2C_TIMEOUT
@@ -68,15 +69,15 @@ const uint8_t i2c_addresses[IS31FL3742A_DRIVER_COUNT] = {
 };
 
 typedef struct is31fl3742a_driver_t {
-    uint8_t pwm_buffer[IS31FL3742A_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t scaling_buffer[IS31FL3742A_SCALING_REGISTER_COUNT];
-    bool    scaling_buffer_dirty;
+    uint8_t  pwm_buffer[IS31FL3742A_PWM_REGISTER_COUNT];
+    uint16_t pwm_buffer_dirty;
+    uint8_t  scaling_buffer[IS31FL3742A_SCALING_REGISTER_COUNT];
+    bool     scaling_buffer_dirty;
 } PACKED is31fl3742a_driver_t;
 
 is31fl3742a_driver_t driver_buffers[IS31FL3742A_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = 0,
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
@@ -100,8 +101,13 @@ void is31fl3742a_write_pwm_buffer(uint8_t index) {
     // Assumes page 0 is already selected.
     // Transmit PWM registers in 6 transfers of 30 bytes.
 
-    // Iterate over the pwm_buffer contents at 30 byte intervals.
+    // Iterate over the pwm_buffer contents at 30 byte intervals,
+    // skipping any that have not changed since the last update.
     for (uint8_t i = 0; i < IS31FL3742A_PWM_REGISTER_COUNT; i += 30) {
+        if (!(driver_buffers[index].pwm_buffer_dirty & IS31FL3742A_PWM_CHUNK(i))) {
+            continue;
+        }
+
 #if IS31FL3742A_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3742A_I2C_PERSISTENCE; j++) {
             if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 30, IS31FL3742A_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
@@ -176,7 +182,7 @@ void is31fl3742a_set_color(int index, uint8_t red, uint8_t green, uint8_t blue)
         driver_buffers[led.driver].pwm_buffer[led.r] = red;
         driver_buffers[led.driver].pwm_buffer[led.g] = green;
         driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= IS31FL3742A_PWM_CHUNK(led.r) | IS31FL3742A_PWM_CHUNK(led.g) | IS31FL3742A_PWM_CHUNK(led.b);
     }
 }
 
@@ -202,7 +208,7 @@ void is31fl3742a_update_pwm_buffers(uint8_t index) {
 
         is31fl3742a_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
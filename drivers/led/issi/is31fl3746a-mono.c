@@ -24,6 +24,7 @@
 #include "wait.h"
 
 #define IS31FL3746A_PWM_REGISTER_COUNT 72
+#define IS31FL3746A_PWM_CHUNK(reg) ((uint16_t)1 << ((reg) / 18))
 #define IS31FL3746A_SCALING_REGISTER_COUNT 72
 
 #ifndef IS31FL3746A_I2C_TIMEOUT
@@ -68,15 +69,15 @@ const uint8_t i2c_addresses[IS31FL3746A_DRIVER_COUNT] = {
 };
 
 typedef struct is31fl3746a_driver_t {
-    uint8_t pwm_buffer[IS31FL3746A_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t scaling_buffer[IS31FL3746A_SCALING_REGISTER_COUNT];
-    bool    scaling_buffer_dirty;
+    uint8_t  pwm_buffer[IS31FL3746A_PWM_REGISTER_COUNT];
+    uint16_t pwm_buffer_dirty;
+    uint8_t  scaling_buffer[IS31FL3746A_SCALING_REGISTER_COUNT];
+    bool     scaling_buffer_dirty;
 } PACKED is31fl3746a_driver_t;
 
 is31fl3746a_driver_t driver_buffers[IS31FL3746A_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = 0,
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
@@ -100,8 +101,13 @@ void is31fl3746a_write_pwm_buffer(uint8_t index) {
     // Assumes page 0 is already selected.
     // Transmit PWM registers in 4 transfers of 18 bytes.
 
-    // Iterate over the pwm_buffer contents at 18 byte intervals.
+    // Iterate over the pwm_buffer contents at 18 byte intervals,
+    // skipping any that have not changed since the last update.
     for (uint8_t i = 0; i < IS31FL3746A_PWM_REGISTER_COUNT; i += 18) {
+        if (!(driver_buffers[index].pwm_buffer_dirty & IS31FL3746A_PWM_CHUNK(i))) {
+            continue;
+        }
+
 #if IS31FL3746A_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3746A_I2C_PERSISTENCE; j++) {
             if (i2c_write_register(i2c_addresses[index] << 1, i + 1, driver_buffers[index].pwm_buffer + i, 18, IS31FL3746A_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
@@ -175,7 +181,7 @@ void is31fl3746a_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= IS31FL3746A_PWM_CHUNK(led.v);
     }
 }
 
@@ -199,7 +205,7 @@ void is31fl3746a_update_pwm_buffers(uint8_t index) {
 
         is31fl3746a_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
@@ -19,6 +19,7 @@
 #include "gpio.h"
 
 #define SNLED27351_PWM_REGISTER_COUNT 192
+#define SNLED27351_PWM_CHUNK(reg) ((uint16_t)1 << ((reg) / 16))
 #define SNLED27351_LED_CONTROL_REGISTER_COUNT 24
 
 #ifndef SNLED27351_I2C_TIMEOUT
@@ -58,15 +59,15 @@ const uint8_t i2c_addresses[SNLED27351_DRIVER_COUNT] = {
 // buffers and the transfers in snled27351_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 typedef struct snled27351_driver_t {
-    uint8_t pwm_buffer[SNLED27351_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t led_control_buffer[SNLED27351_LED_CONTROL_REGISTER_COUNT];
-    bool    led_control_buffer_dirty;
+    uint8_t  pwm_buffer[SNLED27351_PWM_REGISTER_COUNT];
+    uint16_t pwm_buffer_dirty;
+    uint8_t  led_control_buffer[SNLED27351_LED_CONTROL_REGISTER_COUNT];
+    bool     led_control_buffer_dirty;
 } PACKED snled27351_driver_t;
 
 snled27351_driver_t driver_buffers[SNLED27351_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = 0,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
@@ -89,8 +90,13 @@ void snled27351_write_pwm_buffer(uint8_t index) {
     // Assumes PG1 is already selected.
     // Transmit PWM registers in 12 transfers of 16 bytes.
 
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
+    // Iterate over the pwm_buffer contents at 16 byte intervals,
+    // skipping any that have not changed since the last update.
     for (uint8_t i = 0; i < SNLED27351_PWM_REGISTER_COUNT; i += 16) {
+        if (!(driver_buffers[index].pwm_buffer_dirty & SNLED27351_PWM_CHUNK(i))) {
+            continue;
+        }
+
 #if SNLED27351_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < SNLED27351_I2C_PERSISTENCE; j++) {
             if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, SNLED27351_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
@@ -181,7 +187,7 @@ void snled27351_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         driver_buffers[led.driver].pwm_buffer[led.r] = red;
         driver_buffers[led.driver].pwm_buffer[led.g] = green;
         driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= SNLED27351_PWM_CHUNK(led.r) | SNLED27351_PWM_CHUNK(led.g) | SNLED27351_PWM_CHUNK(led.b);
     }
 }
 
@@ -227,7 +233,7 @@ void snled27351_update_pwm_buffers(uint8_t index) {
 
         snled27351_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
@@ -21,6 +21,24 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_RECT_COUNT
+/**
+ * @def This controls the maximum number of separate dirty rectangles each surface tracks. Drawing to areas of the
+ *      surface which are far apart keeps them as separate rectangles, so only the changed areas are sent to the
+ *      target device instead of their combined bounding box. Each rectangle requires 8 bytes of RAM per surface.
+ */
+#    define SURFACE_DIRTY_RECT_COUNT 4
+#endif
+
+#ifndef SURFACE_DIRTY_MERGE_DISTANCE
+/**
+ * @def This controls how close (in pixels) a change needs to be to an existing dirty rectangle to be merged into it,
+ *      rather than starting a new rectangle. Each rectangle costs a separate viewport command when sent to the target
+ *      device, so nearby changes are cheaper to send together.
+ */
+#    define SURFACE_DIRTY_MERGE_DISTANCE 8
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -50,6 +68,15 @@ painter_device_t qp_make_rgb565_surface(uint16_t panel_width, uint16_t panel_hei
  */
 painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_height, void *buffer);
 
+/**
+ * Callback invoked when an asynchronous surface draw completes.
+ *
+ * @param surface[in] the surface which was drawn
+ * @param success[in] whether all of the pixel data was sent to the target device
+ * @param cb_arg[in] the argument supplied to qp_surface_draw_async
+ */
+typedef void (*qp_surface_draw_callback_t)(painter_device_t surface, bool success, void *cb_arg);
+
 /**
  * Helper method to draw the contents of the framebuffer to the target device.
  *
@@ -64,4 +91,39 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * Helper method to draw the contents of the framebuffer to the target device, without blocking.
+ *
+ * The dirty region is captured and reset immediately, and then sent to the target device a pixdata buffer at a time
+ * from the Quantum Painter task (or by calling qp_surface_draw_async_task). Drawing to the surface may continue while
+ * the transfer is in progress; anything changed is marked dirty again and sent by the next draw.
+ *
+ * @param surface[in] the surface to copy from
+ * @param target[in] the target device to copy into
+ * @param x[in] the x-location of the original position of the framebuffer
+ * @param y[in] the y-location of the original position of the framebuffer
+ * @param entire_surface[in] whether the entire surface should be drawn, instead of just the dirty region
+ * @param callback[in] function to invoke once the transfer completes, or NULL
+ * @param cb_arg[in] argument passed to the callback
+ * @return whether the transfer was started -- false if the surface is already being drawn
+ */
+bool qp_surface_draw_async(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface, qp_surface_draw_callback_t callback, void *cb_arg);
+
+/**
+ * Sends the next pixdata buffer of an asynchronous surface draw to its target device. Invoked automatically by the
+ * Quantum Painter task, but may also be invoked directly (such as when a DMA transfer completes).
+ *
+ * @param surface[in] the surface being drawn
+ * @return whether the transfer is still in progress
+ */
+bool qp_surface_draw_async_task(painter_device_t surface);
+
+/**
+ * Checks whether the surface has a draw in progress.
+ *
+ * @param surface[in] the surface to check
+ * @return whether the transfer is still in progress
+ */
+bool qp_surface_draw_in_progress(painter_device_t surface);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
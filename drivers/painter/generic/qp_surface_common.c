@@ -29,24 +29,104 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
+static inline uint16_t dirty_gap(uint16_t a_lo, uint16_t a_hi, uint16_t b_lo, uint16_t b_hi) {
+    // Number of pixels between two spans along one axis, zero if they overlap
+    if (b_lo > a_hi) {
+        return b_lo - a_hi;
+    }
+    if (a_lo > b_hi) {
+        return a_lo - b_hi;
+    }
+    return 0;
+}
+
+static inline bool dirty_rect_is_near(const surface_dirty_rect_t *rect, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    return dirty_gap(rect->l, rect->r, l, r) <= SURFACE_DIRTY_MERGE_DISTANCE && dirty_gap(rect->t, rect->b, t, b) <= SURFACE_DIRTY_MERGE_DISTANCE;
+}
+
+static inline void dirty_rect_include(surface_dirty_rect_t *rect, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    if (rect->l > l) rect->l = l;
+    if (rect->t > t) rect->t = t;
+    if (rect->r < r) rect->r = r;
+    if (rect->b < b) rect->b = b;
+}
+
+static inline uint32_t dirty_rect_area(uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    return (uint32_t)(r - l + 1) * (uint32_t)(b - t + 1);
+}
+
+// Merges any other rectangles near the one at the supplied index into it, until none are left nearby
+static void dirty_rect_absorb(surface_dirty_data_t *dirty, uint8_t index) {
+    bool merged;
+    do {
+        merged = false;
+        for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+            if (i == index) {
+                continue;
+            }
+            surface_dirty_rect_t *other = &dirty->rects[i];
+            if (dirty_rect_is_near(&dirty->rects[index], other->l, other->t, other->r, other->b)) {
+                dirty_rect_include(&dirty->rects[index], other->l, other->t, other->r, other->b);
+
+                // Fill the hole with the last rectangle, keeping track of ours if it was the one moved
+                uint8_t last = --dirty->rect_count;
+                if (i != last) {
+                    dirty->rects[i] = dirty->rects[last];
+                    if (index == last) {
+                        index = i;
+                    }
+                }
+                merged = true;
+                break;
+            }
+        }
+    } while (merged);
+}
+
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
     // Maintain dirty region
     if (dirty->l > x) {
-        dirty->l        = x;
-        dirty->is_dirty = true;
+        dirty->l = x;
     }
     if (dirty->r < x) {
-        dirty->r        = x;
-        dirty->is_dirty = true;
+        dirty->r = x;
     }
     if (dirty->t > y) {
-        dirty->t        = y;
-        dirty->is_dirty = true;
+        dirty->t = y;
     }
     if (dirty->b < y) {
-        dirty->b        = y;
-        dirty->is_dirty = true;
+        dirty->b = y;
+    }
+    dirty->is_dirty = true;
+
+    // Skip out early if the pixel is already covered, otherwise find the rectangle which would grow the least by including
+    // it -- preferring rectangles the pixel is near
+    uint8_t  best        = 0;
+    uint32_t best_growth = UINT32_MAX;
+    bool     best_near   = false;
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        surface_dirty_rect_t *rect = &dirty->rects[i];
+        if (x >= rect->l && x <= rect->r && y >= rect->t && y <= rect->b) {
+            return;
+        }
+        bool     near   = dirty_rect_is_near(rect, x, y, x, y);
+        uint32_t growth = dirty_rect_area(x < rect->l ? x : rect->l, y < rect->t ? y : rect->t, x > rect->r ? x : rect->r, y > rect->b ? y : rect->b) - dirty_rect_area(rect->l, rect->t, rect->r, rect->b);
+        if ((near && !best_near) || (near == best_near && growth < best_growth)) {
+            best        = i;
+            best_growth = growth;
+            best_near   = near;
+        }
     }
+
+    // Start a new rectangle if the pixel is far away from the existing ones and there's room for one
+    if (!best_near && dirty->rect_count < SURFACE_DIRTY_RECT_COUNT) {
+        dirty->rects[dirty->rect_count++] = (surface_dirty_rect_t){.l = x, .t = y, .r = x, .b = y};
+        return;
+    }
+
+    // Otherwise grow the cheapest rectangle, merging in any others it ends up near
+    dirty_rect_include(&dirty->rects[best], x, y, x, y);
+    dirty_rect_absorb(dirty, best);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,11 +137,13 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
+    surface->dirty.l          = 0;
+    surface->dirty.t          = 0;
+    surface->dirty.r          = surface->base.panel_width - 1;
+    surface->dirty.b          = surface->base.panel_height - 1;
+    surface->dirty.is_dirty   = true;
+    surface->dirty.rect_count = 1;
+    surface->dirty.rects[0]   = (surface_dirty_rect_t){.l = surface->dirty.l, .t = surface->dirty.t, .r = surface->dirty.r, .b = surface->dirty.b};
 
     return true;
 }
@@ -83,6 +165,7 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+    surface->dirty.rect_count           = 0;
     return true;
 }
 
@@ -103,7 +186,118 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Drawing routine to copy out the dirty region and send it to another device
+// Drawing routines to copy out the dirty region and send it to another device
+
+// Surfaces with an asynchronous transfer in progress
+static surface_painter_device_t *async_surfaces = NULL;
+
+static bool qp_surface_transfer_begin(surface_painter_device_t *surface_handle, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    painter_driver_t *       surface_driver = &surface_handle->base;
+    surface_transfer_data_t *transfer       = &surface_handle->transfer;
+
+    // If we're already sending, we can't start another
+    if (transfer->target) {
+        qp_dprintf("qp_surface_draw: fail (transfer already in progress)\n");
+        return false;
+    }
+
+    // If we have incompatible bit depths, drop out
+    if (surface_driver->native_bits_per_pixel != target_driver->native_bits_per_pixel) {
+        qp_dprintf("qp_surface_draw: fail (incompatible bpp: surface=%d, target=%d)\n", (int)surface_driver->native_bits_per_pixel, (int)target_driver->native_bits_per_pixel);
+        return false;
+    }
+
+    // Capture what needs to be sent
+    if (entire_surface) {
+        transfer->rect_count = 1;
+        transfer->rects[0]   = (surface_dirty_rect_t){.l = 0, .t = 0, .r = surface_driver->panel_width - 1, .b = surface_driver->panel_height - 1};
+    } else {
+        transfer->rect_count = surface_handle->dirty.rect_count;
+        memcpy(transfer->rects, surface_handle->dirty.rects, sizeof(surface_dirty_rect_t) * transfer->rect_count);
+    }
+    transfer->target       = target_driver;
+    transfer->offset_x     = x;
+    transfer->offset_y     = y;
+    transfer->rect_index   = 0;
+    transfer->viewport_set = false;
+    transfer->callback     = NULL;
+    transfer->cb_arg       = NULL;
+
+    // Clear the dirty info for the surface, so that anything drawn from here on is sent next time
+    bool ok = qp_flush((painter_device_t)surface_driver);
+    if (!ok) {
+        qp_dprintf("qp_surface_draw: fail (could not flush)\n");
+        transfer->target = NULL;
+        return false;
+    }
+    return true;
+}
+
+// Sends the next pixdata buffer's worth of the transfer, returning false on failure
+static bool qp_surface_transfer_step(surface_painter_device_t *surface_handle) {
+    painter_driver_t *               surface_driver = &surface_handle->base;
+    surface_transfer_data_t *        transfer       = &surface_handle->transfer;
+    surface_painter_driver_vtable_t *vtable         = (surface_painter_driver_vtable_t *)surface_driver->driver_vtable;
+    const surface_dirty_rect_t *     rect           = &transfer->rects[transfer->rect_index];
+
+    // Set the target drawing area to whatever's left of the rectangle. If a previous step stopped part-way through a row,
+    // only the rest of that row can be described by a viewport.
+    bool row_viewport = false;
+    if (!transfer->viewport_set) {
+        if (transfer->x == rect->l) {
+            transfer->viewport_set = qp_viewport((painter_device_t)transfer->target, transfer->offset_x + rect->l, transfer->offset_y + transfer->y, transfer->offset_x + rect->r, transfer->offset_y + rect->b);
+        } else {
+            transfer->viewport_set = qp_viewport((painter_device_t)transfer->target, transfer->offset_x + transfer->x, transfer->offset_y + transfer->y, transfer->offset_x + rect->r, transfer->offset_y + transfer->y);
+            row_viewport           = true;
+        }
+        if (!transfer->viewport_set) {
+            qp_dprintf("qp_surface_draw: fail (could not set target viewport)\n");
+            return false;
+        }
+    }
+
+    // Fill the global pixdata area and send it to the panel, without running past the end of a single-row viewport
+    uint32_t max_pixels = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_driver->native_bits_per_pixel;
+    if (row_viewport) {
+        max_pixels = QP_MIN(max_pixels, (uint32_t)(rect->r - transfer->x + 1));
+    }
+    uint32_t pixel_count = vtable->target_pixdata_pack(surface_driver, rect, &transfer->x, &transfer->y, qp_internal_global_pixdata_buffer, max_pixels);
+    if (!qp_pixdata((painter_device_t)transfer->target, qp_internal_global_pixdata_buffer, pixel_count)) {
+        qp_dprintf("qp_surface_draw: fail (could not stream pixdata to target)\n");
+        return false;
+    }
+    if (row_viewport) {
+        transfer->viewport_set = false;
+    }
+
+    // Move on to the next rectangle once this one is complete
+    if (transfer->y > rect->b) {
+        transfer->rect_index++;
+        transfer->viewport_set = false;
+        if (transfer->rect_index < transfer->rect_count) {
+            transfer->x = transfer->rects[transfer->rect_index].l;
+            transfer->y = transfer->rects[transfer->rect_index].t;
+        }
+    }
+    return true;
+}
+
+static void qp_surface_transfer_prepare(surface_transfer_data_t *transfer) {
+    if (transfer->rect_count > 0) {
+        transfer->x = transfer->rects[0].l;
+        transfer->y = transfer->rects[0].t;
+    }
+}
+
+static void qp_surface_async_remove(surface_painter_device_t *surface_handle) {
+    for (surface_painter_device_t **p = &async_surfaces; *p; p = &(*p)->transfer.next_async) {
+        if (*p == surface_handle) {
+            *p = surface_handle->transfer.next_async;
+            break;
+        }
+    }
+    surface_handle->transfer.next_async = NULL;
+}
 
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface) {
     painter_driver_t *        surface_driver = (painter_driver_t *)surface;
@@ -111,31 +305,93 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     painter_driver_t *        target_driver  = (painter_driver_t *)target;
 
     // If we're not dirty... we're done.
-    if (!surface_handle->dirty.is_dirty) {
+    if (!entire_surface && !surface_handle->dirty.is_dirty) {
         qp_dprintf("qp_surface_draw: ok (not dirty, skipping)\n");
         return true;
     }
 
-    // If we have incompatible bit depths, drop out
-    if (surface_driver->native_bits_per_pixel != target_driver->native_bits_per_pixel) {
-        qp_dprintf("qp_surface_draw: fail (incompatible bpp: surface=%d, target=%d)\n", (int)surface_driver->native_bits_per_pixel, (int)target_driver->native_bits_per_pixel);
+    if (!qp_surface_transfer_begin(surface_handle, target_driver, x, y, entire_surface)) {
         return false;
     }
 
-    // Offload to the pixdata transfer function
-    surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)surface_driver->driver_vtable;
-    bool                             ok     = vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, entire_surface);
-    if (!ok) {
-        qp_dprintf("qp_surface_draw: fail (could not transfer pixel data)\n");
-        return false;
+    // Send everything in one go
+    surface_transfer_data_t *transfer = &surface_handle->transfer;
+    bool                     ok       = true;
+    qp_surface_transfer_prepare(transfer);
+    while (ok && transfer->rect_index < transfer->rect_count) {
+        ok = qp_surface_transfer_step(surface_handle);
     }
+    transfer->target = NULL;
 
-    // Clear the dirty info for the surface
-    ok = qp_flush(surface);
-    if (!ok) {
-        qp_dprintf("qp_surface_draw: fail (could not flush)\n");
+    qp_dprintf("qp_surface_draw: %s\n", ok ? "ok" : "fail");
+    return ok;
+}
+
+bool qp_surface_draw_async(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface, qp_surface_draw_callback_t callback, void *cb_arg) {
+    painter_driver_t *        surface_driver = (painter_driver_t *)surface;
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    painter_driver_t *        target_driver  = (painter_driver_t *)target;
+
+    // If we're not dirty... we're done.
+    if (!entire_surface && !surface_handle->dirty.is_dirty && !surface_handle->transfer.target) {
+        qp_dprintf("qp_surface_draw_async: ok (not dirty, skipping)\n");
+        if (callback) {
+            callback(surface, true, cb_arg);
+        }
+        return true;
+    }
+
+    if (!qp_surface_transfer_begin(surface_handle, target_driver, x, y, entire_surface)) {
         return false;
     }
-    qp_dprintf("qp_surface_draw: ok\n");
+
+    // Queue it up for the task to send
+    surface_transfer_data_t *transfer = &surface_handle->transfer;
+    transfer->callback                = callback;
+    transfer->cb_arg                  = cb_arg;
+    transfer->next_async              = async_surfaces;
+    async_surfaces                    = surface_handle;
+    qp_surface_transfer_prepare(transfer);
+    qp_dprintf("qp_surface_draw_async: ok (started)\n");
     return true;
 }
+
+bool qp_surface_draw_async_task(painter_device_t surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface;
+    surface_transfer_data_t * transfer       = &surface_handle->transfer;
+    if (!transfer->target) {
+        return false;
+    }
+
+    // The target may have been drawn to since the last step, so its viewport needs to be set again
+    transfer->viewport_set = false;
+
+    bool ok = transfer->rect_index >= transfer->rect_count || qp_surface_transfer_step(surface_handle);
+    if (ok && transfer->rect_index < transfer->rect_count) {
+        return true;
+    }
+
+    // Finished, one way or another
+    qp_dprintf("qp_surface_draw_async_task: %s\n", ok ? "ok" : "fail");
+    qp_surface_async_remove(surface_handle);
+    transfer->target = NULL;
+    if (transfer->callback) {
+        transfer->callback(surface, ok, transfer->cb_arg);
+    }
+    return false;
+}
+
+bool qp_surface_draw_in_progress(painter_device_t surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface;
+    return surface_handle->transfer.target != NULL;
+}
+
+void qp_surface_internal_async_task(void) {
+    surface_painter_device_t *surface_handle = async_surfaces;
+    while (surface_handle) {
+        // Grab the next one first, as finishing removes this surface from the list
+        surface_painter_device_t *next = surface_handle->transfer.next_async;
+        qp_surface_draw_async_task((painter_device_t)surface_handle);
+        surface_handle = next;
+    }
+}
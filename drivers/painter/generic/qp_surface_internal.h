@@ -9,19 +9,35 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Internal declarations
 
+typedef struct surface_dirty_rect_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} surface_dirty_rect_t;
+
 // Surface vtable
 typedef struct surface_painter_driver_vtable_t {
     painter_driver_vtable_t base; // must be first, so it can be cast to/from the painter_driver_vtable_t* type
 
-    bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
+    // Packs up to max_pixels of the surface's pixels into the buffer in native pixdata format, starting at the cursor and
+    // continuing left-to-right, top-to-bottom within the rectangle. Advances the cursor past the last pixel packed, and returns
+    // the number of pixels packed.
+    uint32_t (*target_pixdata_pack)(painter_driver_t *surface_driver, const surface_dirty_rect_t *rect, uint16_t *cursor_x, uint16_t *cursor_y, uint8_t *buffer, uint32_t max_pixels);
 } surface_painter_driver_vtable_t;
 
 typedef struct surface_dirty_data_t {
-    bool     is_dirty;
+    bool is_dirty;
+
+    // Bounding box of all the dirty rectangles
     uint16_t l;
     uint16_t t;
     uint16_t r;
     uint16_t b;
+
+    // Separate areas which have changed, which never overlap each other
+    uint8_t              rect_count;
+    surface_dirty_rect_t rects[SURFACE_DIRTY_RECT_COUNT];
 } surface_dirty_data_t;
 
 typedef struct surface_viewport_data_t {
@@ -36,6 +52,28 @@ typedef struct surface_viewport_data_t {
     uint16_t pixdata_y;
 } surface_viewport_data_t;
 
+// State of a transfer of a surface's contents to another device
+typedef struct surface_transfer_data_t {
+    painter_driver_t *target; // NULL when no transfer is in progress
+    uint16_t          offset_x;
+    uint16_t          offset_y;
+
+    // Completion notification for asynchronous transfers
+    qp_surface_draw_callback_t callback;
+    void *                     cb_arg;
+
+    // The rectangles being sent, and the next pixel to send
+    uint8_t              rect_count;
+    uint8_t              rect_index;
+    uint16_t             x;
+    uint16_t             y;
+    bool                 viewport_set;
+    surface_dirty_rect_t rects[SURFACE_DIRTY_RECT_COUNT];
+
+    // Next surface with an asynchronous transfer in progress
+    struct surface_painter_device_t *next_async;
+} surface_transfer_data_t;
+
 // Surface struct
 typedef struct surface_painter_device_t {
     painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
@@ -52,6 +90,9 @@ typedef struct surface_painter_device_t {
 
     // Maintain a dirty region so we can stream only what we need
     surface_dirty_data_t dirty;
+
+    // Transfer of the dirty region to another device
+    surface_transfer_data_t transfer;
 } surface_painter_device_t;
 
 /**
@@ -89,6 +130,7 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+void qp_surface_internal_async_task(void);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
@@ -84,8 +84,29 @@ static bool qp_surface_append_pixels_mono1bpp(painter_device_t device, uint8_t *
     return true;
 }
 
-static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    return false; // Not yet supported.
+static uint32_t mono1bpp_target_pixdata_pack(painter_driver_t *surface_driver, const surface_dirty_rect_t *rect, uint16_t *cursor_x, uint16_t *cursor_y, uint8_t *buffer, uint32_t max_pixels) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    uint32_t                  pixel_counter  = 0;
+
+    // Repack the pixels the same way as pixdata input, starting from bit 0 of the buffer
+    while (pixel_counter < max_pixels && *cursor_y <= rect->b) {
+        uint32_t pixel_num   = *cursor_y * surface_handle->base.panel_width + *cursor_x;
+        uint8_t  target_bit  = 1 << (pixel_counter % 8);
+        uint8_t *target_byte = &buffer[pixel_counter / 8];
+        if (surface_handle->u8buffer[pixel_num / 8] & (1 << (pixel_num % 8))) {
+            *target_byte |= target_bit;
+        } else {
+            *target_byte &= ~target_bit;
+        }
+        ++pixel_counter;
+
+        if (++*cursor_x > rect->r) {
+            *cursor_x = rect->l;
+            ++*cursor_y;
+        }
+    }
+
+    return pixel_counter;
 }
 
 static bool qp_surface_append_pixdata_mono1bpp(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
@@ -105,7 +126,7 @@ const surface_painter_driver_vtable_t mono1bpp_surface_driver_vtable = {
             .append_pixels   = qp_surface_append_pixels_mono1bpp,
             .append_pixdata  = qp_surface_append_pixdata_mono1bpp,
         },
-    .target_pixdata_transfer = mono1bpp_target_pixdata_transfer,
+    .target_pixdata_pack = mono1bpp_target_pixdata_pack,
 };
 
 SURFACE_FACTORY_FUNCTION_IMPL(qp_make_mono1bpp_surface, mono1bpp_surface_driver_vtable, 1);
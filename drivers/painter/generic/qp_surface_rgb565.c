@@ -68,55 +68,24 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static uint32_t rgb565_target_pixdata_pack(painter_driver_t *surface_driver, const surface_dirty_rect_t *rect, uint16_t *cursor_x, uint16_t *cursor_y, uint8_t *buffer, uint32_t max_pixels) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
-
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
-
-    // Set the target drawing area
-    bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
-    if (!ok) {
-        qp_dprintf("rgb565_target_pixdata_transfer: fail (could not set target viewport)\n");
-        return false;
-    }
-
-    // Housekeeping of the amount of pixels to transfer
-    uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_driver->native_bits_per_pixel;
-    uint32_t  pixel_counter     = 0;
-    uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
-
-    // Fill the global pixdata area so that we can start transferring to the panel
-    for (uint16_t y = t; y <= b; ++y) {
-        for (uint16_t x = l; x <= r; ++x) {
-            // Update the target buffer
-            target_buffer[pixel_counter++] = surface_handle->u16buffer[y * surface_handle->base.panel_width + x];
-
-            // If we've accumulated enough data, send it
-            if (pixel_counter == total_pixel_count) {
-                ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
-                if (!ok) {
-                    qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
-                    return false;
-                }
-                // Reset the counter
-                pixel_counter = 0;
-            }
+    uint16_t *                target_buffer  = (uint16_t *)buffer;
+    uint32_t                  pixel_counter  = 0;
+
+    // Copy out whole runs of each row at a time
+    while (pixel_counter < max_pixels && *cursor_y <= rect->b) {
+        uint32_t run = QP_MIN((uint32_t)(rect->r - *cursor_x + 1), max_pixels - pixel_counter);
+        memcpy(&target_buffer[pixel_counter], &surface_handle->u16buffer[*cursor_y * surface_handle->base.panel_width + *cursor_x], run * sizeof(uint16_t));
+        pixel_counter += run;
+        *cursor_x += run;
+        if (*cursor_x > rect->r) {
+            *cursor_x = rect->l;
+            ++*cursor_y;
         }
     }
 
-    // If there's any leftover data, send it
-    if (pixel_counter > 0) {
-        ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
-        if (!ok) {
-            qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
-            return false;
-        }
-    }
-
-    return true;
+    return pixel_counter;
 }
 
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
@@ -137,7 +106,7 @@ const surface_painter_driver_vtable_t rgb565_surface_driver_vtable = {
             .append_pixels   = qp_surface_append_pixels_rgb565,
             .append_pixdata  = qp_surface_append_pixdata_rgb565,
         },
-    .target_pixdata_transfer = rgb565_target_pixdata_transfer,
+    .target_pixdata_pack = rgb565_target_pixdata_pack,
 };
 
 SURFACE_FACTORY_FUNCTION_IMPL(qp_make_rgb565_surface, rgb565_surface_driver_vtable, 16);
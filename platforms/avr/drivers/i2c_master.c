@@ -56,6 +56,22 @@ __attribute__((weak)) void i2c_init(void) {
 #endif
 }
 
+#ifdef I2C_BYTE_COUNTER_ENABLE
+static uint32_t i2c_bytes_transferred = 0;
+
+uint32_t i2c_get_bytes_transferred(void) {
+    return i2c_bytes_transferred;
+}
+
+void i2c_reset_bytes_transferred(void) {
+    i2c_bytes_transferred = 0;
+}
+
+#    define i2c_count_byte() i2c_bytes_transferred++
+#else
+#    define i2c_count_byte()
+#endif
+
 static i2c_status_t i2c_start_impl(uint8_t address, uint16_t timeout) {
     // reset TWI control register
     TWCR = 0;
@@ -78,6 +94,7 @@ static i2c_status_t i2c_start_impl(uint8_t address, uint16_t timeout) {
     TWDR = address;
     // start transmission of address
     TWCR = (1 << TWINT) | (1 << TWEN);
+    i2c_count_byte();
 
     timeout_timer = timer_read();
     while (!(TWCR & (1 << TWINT))) {
@@ -116,6 +133,7 @@ i2c_status_t i2c_write(uint8_t data, uint16_t timeout) {
     TWDR = data;
     // start transmission of data
     TWCR = (1 << TWINT) | (1 << TWEN);
+    i2c_count_byte();
 
     uint16_t timeout_timer = timer_read();
     while (!(TWCR & (1 << TWINT))) {
@@ -134,6 +152,7 @@ i2c_status_t i2c_write(uint8_t data, uint16_t timeout) {
 int16_t i2c_read_ack(uint16_t timeout) {
     // start TWI module and acknowledge data after reception
     TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWEA);
+    i2c_count_byte();
 
     uint16_t timeout_timer = timer_read();
     while (!(TWCR & (1 << TWINT))) {
@@ -149,6 +168,7 @@ int16_t i2c_read_ack(uint16_t timeout) {
 int16_t i2c_read_nack(uint16_t timeout) {
     // start receiving without acknowledging reception
     TWCR = (1 << TWINT) | (1 << TWEN);
+    i2c_count_byte();
 
     uint16_t timeout_timer = timer_read();
     while (!(TWCR & (1 << TWINT))) {
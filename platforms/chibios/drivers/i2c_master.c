@@ -128,6 +128,28 @@ static i2c_status_t i2c_epilogue(const msg_t status) {
     return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
 }
 
+#ifdef I2C_BYTE_COUNTER_ENABLE
+static uint32_t i2c_bytes_transferred = 0;
+
+/**
+ * @brief Accounts for a transaction on the bus: one address byte for each
+ * direction used, plus the bytes transmitted and received.
+ */
+static void i2c_count_bytes(size_t txbytes, size_t rxbytes) {
+    i2c_bytes_transferred += (txbytes ? txbytes + 1 : 0) + (rxbytes ? rxbytes + 1 : 0);
+}
+
+uint32_t i2c_get_bytes_transferred(void) {
+    return i2c_bytes_transferred;
+}
+
+void i2c_reset_bytes_transferred(void) {
+    i2c_bytes_transferred = 0;
+}
+#else
+#    define i2c_count_bytes(txbytes, rxbytes)
+#endif
+
 __attribute__((weak)) void i2c_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -150,12 +172,14 @@ __attribute__((weak)) void i2c_init(void) {
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
     i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_count_bytes(length, 0);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
     i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_count_bytes(0, length);
     msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
@@ -169,6 +193,7 @@ i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t*
     }
     complete_packet[0] = regaddr;
 
+    i2c_count_bytes(length + 1, 0);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 1, 0, 0, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
@@ -183,18 +208,21 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
     complete_packet[0] = regaddr >> 8;
     complete_packet[1] = regaddr & 0xFF;
 
+    i2c_count_bytes(length + 2, 0);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 2, 0, 0, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
     i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_count_bytes(1, length);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
     i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_count_bytes(2, length);
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
     msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
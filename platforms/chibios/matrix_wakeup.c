@@ -0,0 +1,69 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ch.h>
+#include <hal.h>
+#include "gpio.h"
+#include "matrix_wakeup.h"
+
+#if !defined(PAL_USE_CALLBACKS) || PAL_USE_CALLBACKS != TRUE
+#    error "MATRIX_WAKEUP_ENABLE requires PAL_USE_CALLBACKS set to TRUE in halconf.h"
+#endif
+
+static BSEMAPHORE_DECL(matrix_wakeup_sem, true);
+
+static void matrix_wakeup_callback(void *arg) {
+    (void)arg;
+    chSysLockFromISR();
+    matrix_wakeup_signal();
+    chBSemSignalI(&matrix_wakeup_sem);
+    chSysUnlockFromISR();
+}
+
+#if defined(MCU_STM32) || defined(MCU_AT32)
+// Each EXTI line serves one pad number across all ports, and enabling it for a second port
+// silently takes it away from the first. Only the first input armed on each line gets an
+// interrupt, others sharing its pad number are caught by polling once the sleep times out.
+static pin_t matrix_wakeup_exti_owner[PAL_IOPORTS_WIDTH];
+
+static bool matrix_wakeup_exti_claim(pin_t pin) {
+    pin_t *owner = &matrix_wakeup_exti_owner[PAL_PAD(pin)];
+    if (*owner != 0 && *owner != pin) {
+        return false;
+    }
+    *owner = pin;
+    return true;
+}
+
+static bool matrix_wakeup_exti_release(pin_t pin) {
+    pin_t *owner = &matrix_wakeup_exti_owner[PAL_PAD(pin)];
+    if (*owner != pin) {
+        return false;
+    }
+    *owner = 0;
+    return true;
+}
+#else
+#    define matrix_wakeup_exti_claim(pin) true
+#    define matrix_wakeup_exti_release(pin) true
+#endif
+
+void matrix_wakeup_pin_enable(pin_t pin) {
+    if (!matrix_wakeup_exti_claim(pin)) {
+        return;
+    }
+    palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+    palSetLineCallback(pin, matrix_wakeup_callback, NULL);
+}
+
+void matrix_wakeup_pin_disable(pin_t pin) {
+    if (!matrix_wakeup_exti_release(pin)) {
+        return;
+    }
+    palDisableLineEvent(pin);
+}
+
+void matrix_wakeup_wait(uint32_t timeout_ms) {
+    // Blocking lets the idle thread put the core to sleep until the next interrupt
+    chBSemWaitTimeout(&matrix_wakeup_sem, TIME_MS2I(timeout_ms));
+}
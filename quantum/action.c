@@ -44,6 +44,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "encoder.h"
 #endif
 
+#ifdef KEY_LATENCY_ENABLE
+#    include "key_latency.h"
+#endif
+
 int tp_buttons;
 
 #if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY) || (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
@@ -284,18 +288,30 @@ void process_record(keyrecord_t *record) {
 #ifdef FLOW_TAP_TERM
     flow_tap_update_last_event(record);
 #endif // FLOW_TAP_TERM
+#if defined(SPECULATIVE_HOLD) && !defined(NO_ACTION_TAPPING)
+    speculative_hold_settle(record);
+#endif
+#ifdef KEY_LATENCY_ENABLE
+    key_latency_mark_t latency = key_latency_begin(&record->event);
+#endif
 
     if (!process_record_quantum(record)) {
 #ifndef NO_ACTION_ONESHOT
         if (is_oneshot_layer_active() && record->event.pressed && keymap_config.oneshot_enable) {
             clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
         }
+#endif
+#ifdef KEY_LATENCY_ENABLE
+        key_latency_end(latency);
 #endif
         return;
     }
 
     process_record_handler(record);
     post_process_record_quantum(record);
+#ifdef KEY_LATENCY_ENABLE
+    key_latency_end(latency);
+#endif
 }
 
 void process_record_handler(keyrecord_t *record) {
@@ -534,6 +550,7 @@ void process_action(keyrecord_t *record, action_t action) {
                     } else {
                         if (tap_count > 0) {
                             ac_dprintf("MODS_TAP: Tap: unregister_code\n");
+                            flush_keyboard_report();
                             if (action.layer_tap.code == KC_CAPS_LOCK) {
                                 wait_ms(TAP_HOLD_CAPS_DELAY);
                             } else {
@@ -715,6 +732,7 @@ void process_action(keyrecord_t *record, action_t action) {
                     } else {
                         if (tap_count > 0) {
                             ac_dprintf("KEYMAP_TAP_KEY: Tap: unregister_code\n");
+                            flush_keyboard_report();
                             if (action.layer_tap.code == KC_CAPS_LOCK) {
                                 wait_ms(TAP_HOLD_CAPS_DELAY);
                             } else {
@@ -732,6 +750,7 @@ void process_action(keyrecord_t *record, action_t action) {
                         register_code(action.layer_tap.code);
                     } else {
                         ac_dprintf("KEYMAP_TAP_KEY: Tap: unregister_code\n");
+                        flush_keyboard_report();
                         if (action.layer_tap.code == KC_CAPS) {
                             wait_ms(TAP_HOLD_CAPS_DELAY);
                         } else {
@@ -805,6 +824,7 @@ void process_action(keyrecord_t *record, action_t action) {
                         if (event.pressed) {
                             register_code(action.swap.code);
                         } else {
+                            flush_keyboard_report();
                             wait_ms(TAP_CODE_DELAY);
                             unregister_code(action.swap.code);
                             *record = (keyrecord_t){}; // hack: reset tap mode
@@ -871,8 +891,10 @@ void process_action(keyrecord_t *record, action_t action) {
                     process_auto_shift(action.layer_tap.code, record);
 #        else
                     register_mods(retro_tap_curr_mods);
+                    flush_keyboard_report();
                     wait_ms(TAP_CODE_DELAY);
                     tap_code(action.layer_tap.code);
+                    flush_keyboard_report();
                     wait_ms(TAP_CODE_DELAY);
                     unregister_mods(retro_tap_curr_mods);
 #        endif
@@ -924,6 +946,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_CAPS_LOCK);
         send_keyboard_report();
+        flush_keyboard_report();
         wait_ms(TAP_HOLD_CAPS_DELAY);
         del_key(KC_CAPS_LOCK);
         send_keyboard_report();
@@ -934,6 +957,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_NUM_LOCK);
         send_keyboard_report();
+        flush_keyboard_report();
         wait_ms(100);
         del_key(KC_NUM_LOCK);
         send_keyboard_report();
@@ -944,6 +968,7 @@ __attribute__((weak)) void register_code(uint8_t code) {
 #    endif
         add_key(KC_SCROLL_LOCK);
         send_keyboard_report();
+        flush_keyboard_report();
         wait_ms(100);
         del_key(KC_SCROLL_LOCK);
         send_keyboard_report();
@@ -1042,6 +1067,7 @@ __attribute__((weak)) void unregister_code(uint8_t code) {
  */
 __attribute__((weak)) void tap_code_delay(uint8_t code, uint16_t delay) {
     register_code(code);
+    flush_keyboard_report();
     wait_ms(delay);
     unregister_code(code);
 }
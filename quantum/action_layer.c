@@ -1,11 +1,13 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
 #include "encoder.h"
 #include "util.h"
 #include "action_layer.h"
+#include "keymap_common.h"
 
 /** \brief Default Layer State
  */
@@ -48,6 +50,7 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_state = state;
     default_layer_debug();
     ac_dprintf("\n");
+    resolved_keymap_cache_invalidate();
 #if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -138,6 +141,7 @@ void layer_state_set(layer_state_t state) {
     layer_state = state;
     layer_debug();
     ac_dprintf("\n");
+    resolved_keymap_cache_invalidate();
 #    if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #    elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -335,11 +339,11 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+/** \brief Layer switch resolve layer
  *
- * Gets the layer based on key info
+ * Finds the topmost non-transparent layer of the key in the current layer state
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
+static uint8_t layer_switch_resolve_layer(keypos_t key) {
 #ifndef NO_ACTION_LAYER
     action_t action;
     action.code = ACTION_TRANSPARENT;
@@ -361,6 +365,57 @@ uint8_t layer_switch_get_layer(keypos_t key) {
 #endif
 }
 
+#if defined(RESOLVED_KEYMAP_CACHE) && !defined(NO_ACTION_LAYER)
+/* Resolved layer + 1 of each key, 0 if the key hasn't been resolved since the last invalidation */
+static uint8_t  resolved_keymap_layers[MATRIX_ROWS][MATRIX_COLS] = {{0}};
+static uint16_t resolved_keymap_keycodes[MATRIX_ROWS][MATRIX_COLS];
+
+/** \brief Resolved keymap cache invalidate
+ *
+ * Drops all cached keys, they get resolved again on their next lookup
+ */
+void resolved_keymap_cache_invalidate(void) {
+    memset(resolved_keymap_layers, 0, sizeof(resolved_keymap_layers));
+}
+
+/** \brief Resolved keymap cache keycode
+ *
+ * Gets the keycode of the key on the given layer, served from the cache if the key resolved to that layer
+ */
+uint16_t resolved_keymap_cache_keycode(uint8_t layer, keypos_t key) {
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS && resolved_keymap_layers[key.row][key.col] == layer + 1) {
+        return resolved_keymap_keycodes[key.row][key.col];
+    }
+    return keymap_key_to_keycode(layer, key);
+}
+
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info, served from the resolved keymap cache if possible
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return layer_switch_resolve_layer(key);
+    }
+
+    uint8_t *cached = &resolved_keymap_layers[key.row][key.col];
+    if (!*cached) {
+        uint8_t layer                              = layer_switch_resolve_layer(key);
+        resolved_keymap_keycodes[key.row][key.col] = keymap_key_to_keycode(layer, key);
+        *cached                                    = layer + 1;
+    }
+    return *cached - 1;
+}
+#else
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+    return layer_switch_resolve_layer(key);
+}
+#endif
+
 /** \brief Layer switch get layer
  *
  * Gets action code based on key position
@@ -169,5 +169,14 @@ action_t store_or_get_action(bool pressed, keypos_t key);
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
+/* resolved keymap cache */
+#if defined(RESOLVED_KEYMAP_CACHE) && !defined(NO_ACTION_LAYER)
+void     resolved_keymap_cache_invalidate(void);
+uint16_t resolved_keymap_cache_keycode(uint8_t layer, keypos_t key);
+#else
+#    define resolved_keymap_cache_invalidate()
+#    define resolved_keymap_cache_keycode(layer, key) keymap_key_to_keycode(layer, key)
+#endif
+
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
@@ -6,6 +6,7 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keycode.h"
+#include "keycode_config.h"
 #include "quantum_keycodes.h"
 #include "timer.h"
 
@@ -110,6 +111,16 @@ static bool     flow_tap_expired      = true;
 static bool flow_tap_key_if_within_term(keyrecord_t *record, uint16_t prev_time);
 #    endif // defined(FLOW_TAP_TERM)
 
+#    if defined(SPECULATIVE_HOLD)
+// Mods registered ahead of settlement for the mod-tap key at speculative_key.
+// Zero when no key is being speculatively held.
+static keypos_t speculative_key  = {};
+static uint8_t  speculative_mods = 0;
+
+/** Registers the hold mods of a freshly pressed mod-tap tapping key. */
+static void speculative_hold_begin(keyrecord_t *record);
+#    endif // defined(SPECULATIVE_HOLD)
+
 static keyrecord_t tapping_key                         = {};
 static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
@@ -142,6 +153,9 @@ void action_tapping_process(keyrecord_t record) {
             clear_keyboard();
             waiting_buffer_clear();
             tapping_key = (keyrecord_t){0};
+#    if defined(SPECULATIVE_HOLD)
+            speculative_mods = 0;
+#    endif // defined(SPECULATIVE_HOLD)
         }
     }
 
@@ -158,6 +172,11 @@ void action_tapping_process(keyrecord_t record) {
             break;
         }
     }
+#    if defined(SPECULATIVE_HOLD)
+    if (IS_EVENT(record.event) && record.event.pressed) {
+        speculative_hold_begin(&record);
+    }
+#    endif // defined(SPECULATIVE_HOLD)
     if (IS_EVENT(record.event)) {
         ac_dprintf("\n");
     } else {
@@ -490,6 +509,9 @@ bool process_tapping(keyrecord_t *keyp) {
                             .event.time    = event.time,
                             .event.pressed = false,
                             .event.type    = tapping_key.event.type,
+#    ifdef KEY_LATENCY_ENABLE
+                            .event.edge_time = event.edge_time,
+#    endif
 #    ifdef COMBO_ENABLE
                             .keycode = tapping_key.keycode,
 #    endif
@@ -541,6 +563,9 @@ bool process_tapping(keyrecord_t *keyp) {
                             .event.time    = event.time,
                             .event.pressed = false,
                             .event.type    = tapping_key.event.type,
+#    ifdef KEY_LATENCY_ENABLE
+                            .event.edge_time = event.edge_time,
+#    endif
 #    ifdef COMBO_ENABLE
                             .keycode = tapping_key.keycode,
 #    endif
@@ -911,6 +936,63 @@ __attribute__((weak)) uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *
 }
 #    endif // FLOW_TAP_TERM
 
+#    if defined(SPECULATIVE_HOLD)
+/** Converts the 5-bit mods of a mod-tap keycode to an 8-bit mod mask. */
+static uint8_t speculative_hold_mod_mask(uint16_t keycode) {
+    const uint8_t mods = mod_config(QK_MOD_TAP_GET_MODS(keycode));
+    return (mods & 0x10) ? (mods & 0x0F) << 4 : mods;
+}
+
+// By default, speculatively hold only Shift and Ctrl. These are harmless when
+// registered on their own, unlike Alt or GUI, which on some hosts trigger
+// menus or the start menu when pressed and released alone.
+__attribute__((weak)) bool get_speculative_hold(uint16_t keycode, keyrecord_t *record) {
+    const uint8_t mods = mod_config(QK_MOD_TAP_GET_MODS(keycode)) & 0x0F;
+    return (mods & ~(MOD_LCTL | MOD_LSFT)) == 0;
+}
+
+static void speculative_hold_begin(keyrecord_t *record) {
+    // Only speculate on a press that just became the unsettled tapping key.
+    // Presses queued behind another tap-hold key are not sped up.
+    if (speculative_mods != 0 || !tapping_key.event.pressed || tapping_key.tap.count != 0 || !KEYEQ(tapping_key.event.key, record->event.key) || tapping_key.event.time != record->event.time) {
+        return;
+    }
+
+    const uint16_t keycode = get_record_keycode(&tapping_key, false);
+    if (!IS_QK_MOD_TAP(keycode) || !get_speculative_hold(keycode, &tapping_key)) {
+        return;
+    }
+
+    // Leave alone any of the mods that are already held by other keys.
+    const uint8_t mods = speculative_hold_mod_mask(keycode) & ~get_mods();
+    if (mods == 0) {
+        return;
+    }
+
+    ac_dprintf("Speculative hold: register mods 0x%02X\n", mods);
+    speculative_key  = tapping_key.event.key;
+    speculative_mods = mods;
+    add_mods(mods);
+    send_keyboard_report();
+}
+
+void speculative_hold_settle(keyrecord_t *record) {
+    if (speculative_mods == 0 || !KEYEQ(record->event.key, speculative_key)) {
+        return;
+    }
+
+    if (!record->event.pressed || record->tap.count > 0) {
+        // Settled as tapped: retract the mods before the tap keycode is sent.
+        ac_dprintf("Speculative hold: retract mods 0x%02X\n", speculative_mods);
+        del_mods(speculative_mods);
+        send_keyboard_report();
+    }
+    // When settled as held, the hold action registers the same mods and takes
+    // over unregistering them on release.
+    speculative_mods = 0;
+}
+#    endif // defined(SPECULATIVE_HOLD)
+
 /** \brief Logs tapping key if ACTION_DEBUG is enabled. */
 static void debug_tapping_key(void) {
     ac_dprintf("TAPPING_KEY=");
@@ -171,6 +171,27 @@ uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *record, uint16_t prev_
 void flow_tap_update_last_event(keyrecord_t *record);
 #endif // FLOW_TAP_TERM
 
+#ifdef SPECULATIVE_HOLD
+/**
+ * Callback to say whether a mod-tap key's mods may be held speculatively.
+ *
+ * When this returns true, the mods of a pressed mod-tap key are registered
+ * immediately rather than when the key settles as held. If the key then
+ * settles as tapped, the mods are retracted before the tap keycode is sent.
+ *
+ * The default implementation returns true for mod-tap keys whose mods are
+ * only Shift and/or Ctrl, on either side.
+ *
+ * @param keycode Keycode of the mod-tap key.
+ * @param record  Record from the mod-tap press event.
+ * @return True to register the mods before the key settles.
+ */
+bool get_speculative_hold(uint16_t keycode, keyrecord_t *record);
+
+/** Retracts or hands over speculatively held mods when `record`'s key settles. */
+void speculative_hold_settle(keyrecord_t *record);
+#endif // SPECULATIVE_HOLD
+
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
 extern uint16_t g_tapping_term;
 #endif
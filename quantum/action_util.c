@@ -22,6 +22,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "timer.h"
 #include "keycode_config.h"
 #include <string.h>
+#ifdef KEY_LATENCY_ENABLE
+#    include "key_latency.h"
+#endif
 
 extern keymap_config_t keymap_config;
 
@@ -282,19 +285,110 @@ static uint8_t get_mods_for_report(void) {
     return mods;
 }
 
-void send_6kro_report(void) {
-    keyboard_report->mods = get_mods_for_report();
+static report_keyboard_t last_6kro_report;
+#ifdef NKRO_ENABLE
+static report_nkro_t last_nkro_report;
+#endif
 
+static void transmit_6kro_report(report_keyboard_t *report) {
 #ifdef PROTOCOL_VUSB
-    host_keyboard_send(keyboard_report);
+    memcpy(&last_6kro_report, report, sizeof(report_keyboard_t));
+    host_keyboard_send(report);
 #else
-    static report_keyboard_t last_report;
+    /* Only send the report if there are changes to propagate to the host. */
+    if (memcmp(report, &last_6kro_report, sizeof(report_keyboard_t)) != 0) {
+        memcpy(&last_6kro_report, report, sizeof(report_keyboard_t));
+        host_keyboard_send(report);
+    }
+#endif
+}
 
+#ifdef NKRO_ENABLE
+static void transmit_nkro_report(report_nkro_t *report) {
     /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(keyboard_report, &last_report, sizeof(report_keyboard_t)) != 0) {
-        memcpy(&last_report, keyboard_report, sizeof(report_keyboard_t));
-        host_keyboard_send(keyboard_report);
+    if (memcmp(report, &last_nkro_report, sizeof(report_nkro_t)) != 0) {
+        memcpy(&last_nkro_report, report, sizeof(report_nkro_t));
+        host_nkro_send(report);
     }
+}
+#endif
+
+#ifdef COALESCE_KEYBOARD_REPORTS
+/* Reports waiting to be sent by flush_keyboard_report(), as they were when last updated. */
+static report_keyboard_t pending_6kro_report;
+static bool              pending_6kro = false;
+#    ifdef NKRO_ENABLE
+static report_nkro_t pending_nkro_report;
+static bool          pending_nkro = false;
+#    endif
+#    ifdef KEY_LATENCY_ENABLE
+/* The switch edge the pending reports are answering, attributed when they are actually sent. */
+static key_latency_mark_t pending_latency;
+#    endif
+
+static bool report_has_key(const report_keyboard_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Whether the new report undoes a change that is still pending, which the host would then never see. */
+static bool reverts_pending_6kro(const report_keyboard_t *report) {
+    if ((pending_6kro_report.mods ^ last_6kro_report.mods) & (pending_6kro_report.mods ^ report->mods)) {
+        return true;
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        // Pressed then released, or released then pressed again
+        uint8_t pressed = pending_6kro_report.keys[i];
+        if (pressed && !report_has_key(&last_6kro_report, pressed) && !report_has_key(report, pressed)) {
+            return true;
+        }
+        uint8_t released = last_6kro_report.keys[i];
+        if (released && !report_has_key(&pending_6kro_report, released) && report_has_key(report, released)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#    ifdef NKRO_ENABLE
+static bool reverts_pending_nkro(const report_nkro_t *report) {
+    if ((pending_nkro_report.mods ^ last_nkro_report.mods) & (pending_nkro_report.mods ^ report->mods)) {
+        return true;
+    }
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        if ((pending_nkro_report.bits[i] ^ last_nkro_report.bits[i]) & (pending_nkro_report.bits[i] ^ report->bits[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+#    endif
+#endif
+
+void send_6kro_report(void) {
+    keyboard_report->mods = get_mods_for_report();
+
+#ifdef COALESCE_KEYBOARD_REPORTS
+    /* Changes are only merged while they build on each other -- anything undone before it was sent goes out first. */
+#    ifdef NKRO_ENABLE
+    if (pending_nkro) {
+        flush_keyboard_report();
+    }
+#    endif
+    if (pending_6kro && reverts_pending_6kro(keyboard_report)) {
+        flush_keyboard_report();
+    }
+    memcpy(&pending_6kro_report, keyboard_report, sizeof(report_keyboard_t));
+    pending_6kro = true;
+#    ifdef KEY_LATENCY_ENABLE
+    key_latency_hold(&pending_latency);
+#    endif
+#else
+    transmit_6kro_report(keyboard_report);
 #endif
 }
 
@@ -302,16 +396,47 @@ void send_6kro_report(void) {
 void send_nkro_report(void) {
     nkro_report->mods = get_mods_for_report();
 
-    static report_nkro_t last_report;
-
-    /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(nkro_report, &last_report, sizeof(report_nkro_t)) != 0) {
-        memcpy(&last_report, nkro_report, sizeof(report_nkro_t));
-        host_nkro_send(nkro_report);
+#    ifdef COALESCE_KEYBOARD_REPORTS
+    if (pending_6kro || (pending_nkro && reverts_pending_nkro(nkro_report))) {
+        flush_keyboard_report();
     }
+    memcpy(&pending_nkro_report, nkro_report, sizeof(report_nkro_t));
+    pending_nkro = true;
+#        ifdef KEY_LATENCY_ENABLE
+    key_latency_hold(&pending_latency);
+#        endif
+#    else
+    transmit_nkro_report(nkro_report);
+#    endif
 }
 #endif
 
+/** \brief Flush keyboard report
+ *
+ * Sends any keyboard report held back by COALESCE_KEYBOARD_REPORTS. Call this where the host must see an
+ * intermediate state before continuing, such as before waiting between a press and release. Does nothing otherwise.
+ */
+void flush_keyboard_report(void) {
+#ifdef COALESCE_KEYBOARD_REPORTS
+#    ifdef KEY_LATENCY_ENABLE
+    key_latency_mark_t latency = key_latency_resume(&pending_latency);
+#    endif
+    if (pending_6kro) {
+        pending_6kro = false;
+        transmit_6kro_report(&pending_6kro_report);
+    }
+#    ifdef NKRO_ENABLE
+    if (pending_nkro) {
+        pending_nkro = false;
+        transmit_nkro_report(&pending_nkro_report);
+    }
+#    endif
+#    ifdef KEY_LATENCY_ENABLE
+    key_latency_end(latency);
+#    endif
+#endif
+}
+
 /** \brief Send keyboard report
  *
  * FIXME: needs doc
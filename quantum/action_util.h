@@ -31,6 +31,7 @@ extern report_nkro_t *nkro_report;
 #endif
 
 void send_keyboard_report(void);
+void flush_keyboard_report(void);
 
 /* key */
 inline void add_key(uint8_t key) {
@@ -53,7 +53,8 @@ rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
     v = hsv.v;
 #endif
 
-    region    = h * 6 / 255;
+    // h * 6 / 255 without the division, exact for the whole 0-1530 range
+    region    = (h * 6 + (h * 6 >> 8) + 1) >> 8;
     remainder = (h * 2 - region * 85) * 3;
 
     p = (v * (255 - s)) >> 8;
@@ -108,3 +109,28 @@ rgb_t hsv_to_rgb(hsv_t hsv) {
 rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
+
+void hsv_to_rgb_buffer(const hsv_t *hsv, rgb_t *rgb, uint16_t count) {
+#ifdef USE_CIE1931_CURVE
+    const bool use_cie = true;
+#else
+    const bool use_cie = false;
+#endif
+
+    if (count == 0) {
+        return;
+    }
+
+    hsv_t last_hsv = hsv[0];
+    rgb_t last_rgb = hsv_to_rgb_impl(last_hsv, use_cie);
+
+    for (uint16_t i = 0; i < count; i++) {
+        hsv_t cur = hsv[i];
+        // Neighbouring LEDs are often the same color, so reuse the previous result where possible
+        if (cur.h != last_hsv.h || cur.s != last_hsv.s || cur.v != last_hsv.v) {
+            last_hsv = cur;
+            last_rgb = hsv_to_rgb_impl(cur, use_cie);
+        }
+        rgb[i] = last_rgb;
+    }
+}
@@ -95,3 +95,6 @@ typedef hsv_t HSV;
 
 rgb_t hsv_to_rgb(hsv_t hsv);
 rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+
+// Converts `count` colors as hsv_to_rgb() would; `hsv` and `rgb` may be the same buffer
+void hsv_to_rgb_buffer(const hsv_t *hsv, rgb_t *rgb, uint16_t count);
@@ -4,12 +4,26 @@
 #include <stdbool.h>
 #include "matrix.h"
 
+/**
+ * @brief Number of rows passed to debounce(), which sizes the static debounce state.
+ *
+ * Split keyboards only debounce the rows of their own half. Custom matrix
+ * code that debounces a different number of rows must define this.
+ */
+#ifndef DEBOUNCE_NUM_ROWS
+#    ifdef SPLIT_KEYBOARD
+#        define DEBOUNCE_NUM_ROWS (MATRIX_ROWS / 2)
+#    else
+#        define DEBOUNCE_NUM_ROWS (MATRIX_ROWS)
+#    endif
+#endif
+
 /**
  * @brief Debounce raw matrix events according to the choosen debounce algorithm.
  *
  * @param raw The current key state
  * @param cooked The debounced key state
- * @param num_rows Number of rows to debounce
+ * @param num_rows Number of rows to debounce, rows past DEBOUNCE_NUM_ROWS are copied to cooked undebounced
  * @param changed True if raw has changed since the last call
  * @return true Cooked has new keychanges after debouncing
  * @return false Cooked is the same as before
@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "debounce.h"
+#include "debug.h"
+
+/**
+ * @brief Copies rows past DEBOUNCE_NUM_ROWS straight from raw to cooked.
+ *
+ * The static state of the per-row and per-key algorithms only covers
+ * DEBOUNCE_NUM_ROWS rows. Extra rows are passed through undebounced, with a
+ * console warning, rather than having their keys dropped.
+ *
+ * @param num_rows Number of rows passed to debounce(), lowered to DEBOUNCE_NUM_ROWS
+ * @return true if any of the extra rows changed in cooked
+ */
+static inline bool debounce_pass_through_extra_rows(matrix_row_t raw[], matrix_row_t cooked[], uint8_t *num_rows) {
+    if (*num_rows <= DEBOUNCE_NUM_ROWS) {
+        return false;
+    }
+
+    static bool warned = false;
+    if (!warned) {
+        dprintf("debounce: %u rows passed, only %u debounced, define DEBOUNCE_NUM_ROWS\n", *num_rows, DEBOUNCE_NUM_ROWS);
+        warned = true;
+    }
+
+    bool changed = false;
+    for (uint8_t row = DEBOUNCE_NUM_ROWS; row < *num_rows; row++) {
+        if (cooked[row] != raw[row]) {
+            cooked[row] = raw[row];
+            changed     = true;
+        }
+    }
+    *num_rows = DEBOUNCE_NUM_ROWS;
+    return changed;
+}
@@ -20,14 +20,9 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 */
 
 #include "debounce.h"
+#include "debounce_rows.h"
 #include "timer.h"
-#include <stdlib.h>
-
-#ifdef PROTOCOL_CHIBIOS
-#    if CH_CFG_USE_MEMCORE == FALSE
-#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
-#    endif
-#endif
+#include <string.h>
 
 #ifndef DEBOUNCE
 #    define DEBOUNCE 5
@@ -44,33 +39,29 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 typedef uint8_t debounce_counter_t;
 
 #if DEBOUNCE > 0
-static debounce_counter_t *debounce_counters;
-static fast_timer_t        last_time;
-static bool                counters_need_update;
-static bool                cooked_changed;
+static debounce_counter_t debounce_counters[DEBOUNCE_NUM_ROWS * MATRIX_COLS];
+static fast_timer_t       last_time;
+static bool               counters_need_update;
+static bool               cooked_changed;
 
 #    define DEBOUNCE_ELAPSED 0
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
 static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
 
-// we use num_rows rather than MATRIX_ROWS to support split keyboards
+// state is sized for DEBOUNCE_NUM_ROWS, so only the rows of this half on split keyboards
 void debounce_init(uint8_t num_rows) {
-    debounce_counters = (debounce_counter_t *)malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
-    int i             = 0;
-    for (uint8_t r = 0; r < num_rows; r++) {
-        for (uint8_t c = 0; c < MATRIX_COLS; c++) {
-            debounce_counters[i++] = DEBOUNCE_ELAPSED;
-        }
-    }
+    memset(debounce_counters, DEBOUNCE_ELAPSED, sizeof(debounce_counters));
+    counters_need_update = false;
 }
 
 void debounce_free(void) {
-    free(debounce_counters);
-    debounce_counters = NULL;
+    debounce_init(DEBOUNCE_NUM_ROWS);
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool extra_rows_changed = debounce_pass_through_extra_rows(raw, cooked, &num_rows);
+
     bool updated_last = false;
     cooked_changed    = false;
 
@@ -97,7 +88,7 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
         start_debounce_counters(raw, cooked, num_rows);
     }
 
-    return cooked_changed;
+    return cooked_changed || extra_rows_changed;
 }
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
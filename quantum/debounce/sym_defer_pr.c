@@ -18,8 +18,9 @@ DEBOUNCE milliseconds have elapsed since the last change.
 */
 
 #include "debounce.h"
+#include "debounce_rows.h"
 #include "timer.h"
-#include <stdlib.h>
+#include <string.h>
 
 #ifndef DEBOUNCE
 #    define DEBOUNCE 5
@@ -27,25 +28,24 @@ DEBOUNCE milliseconds have elapsed since the last change.
 
 static uint16_t last_time;
 // [row] milliseconds until key's state is considered debounced.
-static uint8_t* countdowns;
+static uint8_t countdowns[DEBOUNCE_NUM_ROWS];
 // [row]
-static matrix_row_t* last_raw;
+static matrix_row_t last_raw[DEBOUNCE_NUM_ROWS];
 
 void debounce_init(uint8_t num_rows) {
-    countdowns = (uint8_t*)calloc(num_rows, sizeof(uint8_t));
-    last_raw   = (matrix_row_t*)calloc(num_rows, sizeof(matrix_row_t));
+    memset(countdowns, 0, sizeof(countdowns));
+    memset(last_raw, 0, sizeof(last_raw));
 
     last_time = timer_read();
 }
 
 void debounce_free(void) {
-    free(countdowns);
-    countdowns = NULL;
-    free(last_raw);
-    last_raw = NULL;
+    debounce_init(DEBOUNCE_NUM_ROWS);
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool extra_rows_changed = debounce_pass_through_extra_rows(raw, cooked, &num_rows);
+
     uint16_t now           = timer_read();
     uint16_t elapsed16     = TIMER_DIFF_16(now, last_time);
     last_time              = now;
@@ -69,7 +69,7 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
         }
     }
 
-    return cooked_changed;
+    return cooked_changed || extra_rows_changed;
 }
 
 bool debounce_active(void) {
@@ -0,0 +1,181 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Per-key algorithm using vertical counters, with the same behaviour as sym_eager_pk.
+Each bit of the per-key counters is stored in its own matrix_row_t, so a whole row of
+counters is started, decremented and checked with a few bitwise operations.
+After pressing a key, it immediately changes state, and sets a counter.
+No further inputs are accepted until DEBOUNCE milliseconds have occurred.
+*/
+
+#include "debounce.h"
+#include "debounce_rows.h"
+#include "timer.h"
+#include <string.h>
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+// Number of bits needed to hold DEBOUNCE
+#if DEBOUNCE < 2
+#    define DEBOUNCE_PLANES 1
+#elif DEBOUNCE < 4
+#    define DEBOUNCE_PLANES 2
+#elif DEBOUNCE < 8
+#    define DEBOUNCE_PLANES 3
+#elif DEBOUNCE < 16
+#    define DEBOUNCE_PLANES 4
+#elif DEBOUNCE < 32
+#    define DEBOUNCE_PLANES 5
+#elif DEBOUNCE < 64
+#    define DEBOUNCE_PLANES 6
+#elif DEBOUNCE < 128
+#    define DEBOUNCE_PLANES 7
+#else
+#    define DEBOUNCE_PLANES 8
+#endif
+
+#if DEBOUNCE > 0
+// DEBOUNCE_PLANES words per row, bit n of every counter in the row in word n
+static matrix_row_t debounce_counters[DEBOUNCE_NUM_ROWS * DEBOUNCE_PLANES];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         matrix_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time);
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// state is sized for DEBOUNCE_NUM_ROWS, so only the rows of this half on split keyboards
+void debounce_init(uint8_t num_rows) {
+    memset(debounce_counters, 0, sizeof(debounce_counters));
+    counters_need_update = false;
+    matrix_need_update   = false;
+}
+
+void debounce_free(void) {
+    debounce_init(DEBOUNCE_NUM_ROWS);
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool extra_rows_changed = debounce_pass_through_extra_rows(raw, cooked, &num_rows);
+
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters(num_rows, elapsed_time);
+        }
+    }
+
+    if (changed || matrix_need_update) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        transfer_matrix_values(raw, cooked, num_rows);
+    }
+
+    return cooked_changed || extra_rows_changed;
+}
+
+// Keys in the row whose counter is running
+static inline matrix_row_t counters_active(const matrix_row_t planes[]) {
+    matrix_row_t active = 0;
+    for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+        active |= planes[bit];
+    }
+    return active;
+}
+
+// Subtracts elapsed_time from the active counters of a row, returning the ones that reached zero
+static matrix_row_t decrement_counters(matrix_row_t planes[], matrix_row_t active, uint8_t elapsed_time) {
+    matrix_row_t expired;
+
+    if (elapsed_time > DEBOUNCE) {
+        expired = active;
+    } else {
+        // Ripple-borrow subtraction of the same value from every counter
+        matrix_row_t borrow    = 0;
+        matrix_row_t remaining = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+            matrix_row_t subtrahend = (elapsed_time & (1 << bit)) ? ~(matrix_row_t)0 : 0;
+            matrix_row_t counter    = planes[bit];
+
+            planes[bit] = (counter ^ subtrahend ^ borrow) & active;
+            borrow      = (~counter & (subtrahend | borrow)) | (counter & subtrahend & borrow);
+            remaining |= planes[bit];
+        }
+        expired = active & (borrow | ~remaining);
+    }
+
+    for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+        planes[bit] &= ~expired;
+    }
+    return expired;
+}
+
+// If the current time is > debounce counter, set the counter to enable input.
+static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    matrix_need_update   = false;
+    matrix_row_t *planes = debounce_counters;
+    for (uint8_t row = 0; row < num_rows; row++, planes += DEBOUNCE_PLANES) {
+        matrix_row_t active = counters_active(planes);
+        if (!active) {
+            continue;
+        }
+
+        matrix_row_t expired = decrement_counters(planes, active, elapsed_time);
+        if (expired) {
+            matrix_need_update = true;
+        }
+        if (active & ~expired) {
+            counters_need_update = true;
+        }
+    }
+}
+
+// upload from raw_matrix to final matrix;
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    matrix_need_update   = false;
+    matrix_row_t *planes = debounce_counters;
+    for (uint8_t row = 0; row < num_rows; row++, planes += DEBOUNCE_PLANES) {
+        // Changed keys whose counter is idle flip immediately and start their counter
+        matrix_row_t flip = (raw[row] ^ cooked[row]) & ~counters_active(planes);
+        if (!flip) {
+            continue;
+        }
+
+        for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+            if (DEBOUNCE & (1 << bit)) {
+                planes[bit] |= flip;
+            }
+        }
+        counters_need_update = true;
+        cooked[row] ^= flip;
+        cooked_changed = true;
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,5 @@
+UNIT_BENCH_LIST += \
+	debounce_benchmark_sym_defer_pk \
+	debounce_benchmark_sym_defer_vc \
+	debounce_benchmark_sym_eager_pk \
+	debounce_benchmark_sym_eager_vc
@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+extern "C" {
+#include "debounce.h"
+#include "matrix.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class DebounceBenchmark : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(7777);
+        std::fill(std::begin(raw_), std::end(raw_), 0);
+        std::fill(std::begin(cooked_), std::end(cooked_), 0);
+        debounce_init(MATRIX_ROWS);
+    }
+
+    void TearDown() override {
+        debounce_free();
+    }
+
+    /* Runs one scan per millisecond, flipping `flips` switches before each one, and reports the cost per scan. */
+    void run(const char *name, int scans, int flips) {
+        uint32_t seed = 1;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int scan = 0; scan < scans; scan++) {
+            for (int i = 0; i < flips; i++) {
+                seed = seed * 1103515245 + 12345;
+                raw_[(seed >> 8) % MATRIX_ROWS] ^= (matrix_row_t)1 << ((seed >> 16) % MATRIX_COLS);
+            }
+            debounce(raw_, cooked_, MATRIX_ROWS, flips > 0);
+            advance_time(1);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << "[ DEBOUNCE ] " << MATRIX_ROWS << "x" << MATRIX_COLS << " " << name << ": " << elapsed.count() / scans << " ns/scan" << std::endl;
+        RecordProperty(std::string(name) + "_ns_per_scan", std::to_string(elapsed.count() / scans));
+
+        /* Once the switches settle, the debounced matrix must catch up with them. */
+        for (int i = 0; i <= DEBOUNCE + 1; i++) {
+            debounce(raw_, cooked_, MATRIX_ROWS, false);
+            advance_time(1);
+        }
+        EXPECT_TRUE(std::equal(std::begin(raw_), std::end(raw_), std::begin(cooked_)));
+    }
+
+    matrix_row_t raw_[MATRIX_ROWS];
+    matrix_row_t cooked_[MATRIX_ROWS];
+};
+
+TEST_F(DebounceBenchmark, Idle) {
+    run("idle", 100000, 0);
+}
+
+TEST_F(DebounceBenchmark, Typing) {
+    run("typing", 100000, 1);
+}
+
+TEST_F(DebounceBenchmark, Chatter) {
+    run("chatter", 100000, MATRIX_ROWS * MATRIX_COLS / 8);
+}
@@ -16,6 +16,7 @@
 DEBOUNCE_COMMON_DEFS := -DMATRIX_ROWS=4 -DMATRIX_COLS=10 -DDEBOUNCE=5
 
 DEBOUNCE_COMMON_SRC := $(QUANTUM_PATH)/debounce/tests/debounce_test_common.cpp \
+	$(QUANTUM_PATH)/logging/debug.c \
 	$(PLATFORM_PATH)/timer.c \
 	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
 
@@ -44,12 +45,46 @@ debounce_sym_eager_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_eager_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_eager_pk_tests.cpp
 
+debounce_sym_defer_vc_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_vc_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_vc.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+
 debounce_sym_eager_pr_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_eager_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_eager_pr.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_eager_pr_tests.cpp
 
+debounce_sym_eager_vc_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_eager_vc_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_vc.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_eager_pk_tests.cpp
+
 debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+# Throughput on a 32x32 matrix, per-key counters against vertical counters
+DEBOUNCE_BENCHMARK_DEFS := -DMATRIX_ROWS=32 -DMATRIX_COLS=32 -DDEBOUNCE=5
+
+DEBOUNCE_BENCHMARK_SRC := $(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp \
+	$(QUANTUM_PATH)/logging/debug.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+debounce_benchmark_sym_defer_pk_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_benchmark_sym_defer_pk_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c
+
+debounce_benchmark_sym_defer_vc_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_benchmark_sym_defer_vc_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_vc.c
+
+debounce_benchmark_sym_eager_pk_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_benchmark_sym_eager_pk_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_pk.c
+
+debounce_benchmark_sym_eager_vc_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_benchmark_sym_eager_vc_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_vc.c
@@ -18,6 +18,10 @@
 
 #include "debounce_test_common.h"
 
+extern "C" {
+#include "debounce.h"
+}
+
 TEST_F(DebounceTest, OneKeyShort1) {
     addEvents({
         /* Time, Inputs, Outputs */
@@ -256,3 +260,21 @@ TEST_F(DebounceTest, AsyncTickOneKeyShort1) {
     async_time_jumps_ = DEBOUNCE;
     runEvents();
 }
+
+TEST(DebounceExtraRows, PassedThroughUndebounced) {
+    // More rows than the state holds, the last one is copied straight through
+    matrix_row_t raw[DEBOUNCE_NUM_ROWS + 1]    = {0};
+    matrix_row_t cooked[DEBOUNCE_NUM_ROWS + 1] = {0};
+    debounce_init(DEBOUNCE_NUM_ROWS);
+
+    raw[0]                 = 1;
+    raw[DEBOUNCE_NUM_ROWS] = 1;
+    EXPECT_TRUE(debounce(raw, cooked, DEBOUNCE_NUM_ROWS + 1, true));
+    EXPECT_EQ(cooked[0], 0);
+    EXPECT_EQ(cooked[DEBOUNCE_NUM_ROWS], 1);
+
+    raw[DEBOUNCE_NUM_ROWS] = 0;
+    EXPECT_TRUE(debounce(raw, cooked, DEBOUNCE_NUM_ROWS + 1, true));
+    EXPECT_EQ(cooked[DEBOUNCE_NUM_ROWS], 0);
+    debounce_free();
+}
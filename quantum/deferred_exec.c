@@ -4,39 +4,164 @@
 #include <stddef.h>
 #include <timer.h>
 #include <deferred_exec.h>
+#include "compiler_support.h"
 
 #ifndef MAX_DEFERRED_EXECUTORS
 #    define MAX_DEFERRED_EXECUTORS 8
 #endif
 
+STATIC_ASSERT(MAX_DEFERRED_EXECUTORS <= UINT8_MAX, "MAX_DEFERRED_EXECUTORS must be at most 255");
+
 //------------------------------------
 // Helpers
 //
+// Each table is kept as a binary min-heap on trigger time, with the active executors packed at the front, so only
+// the earliest one needs checking each millisecond. Executors move around the heap, so each also has a fixed slot:
+// a token always maps to the same slot, and table[slot].position records where that slot's executor currently is.
+// Positions past the active executors hold the free slots.
+//
 
 static deferred_token current_token = 0;
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
+static inline bool trigger_before(uint32_t a, uint32_t b) {
+    return ((int32_t)TIMER_DIFF_32(a, b)) < 0;
+}
+
+static inline size_t active_count(deferred_executor_t *table, size_t table_count) {
+    // Active executors are always at the front of the table, so binary search for the first free position
+    size_t low = 0, high = table_count;
+    while (low < high) {
+        size_t mid = (low + high) / 2;
+        if (table[mid].token != INVALID_DEFERRED_TOKEN) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static inline void init_slots(deferred_executor_t *table, size_t table_count) {
+    // A zero-initialised table has every position claiming slot 0
+    if (table_count > 1 && table[0].slot == table[1].slot) {
+        for (size_t i = 0; i < table_count; ++i) {
+            table[i].slot     = i;
+            table[i].position = i;
+        }
+    }
+}
+
+static inline deferred_token allocate_token(size_t table_count, uint8_t slot) {
+    // Use the next token in sequence that maps to the slot, wrapping around if we've run out
+    uint16_t token = current_token + 1 + (slot + table_count - (current_token % table_count)) % table_count;
+    if (token > UINT8_MAX) {
+        token = slot + 1;
+    }
+    current_token = token;
+    return current_token;
+}
+
+static inline int find_token(deferred_executor_t *table, size_t table_count, deferred_token token) {
     if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+        return -1;
     }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+    uint8_t position = table[(token - 1) % table_count].position;
+    return table[position].token == token ? position : -1;
+}
+
+static void swap_executors(deferred_executor_t *table, size_t a, size_t b) {
+    // The position field belongs to the slot indexing it, not to the executor, so it stays put
+    uint8_t             position_a = table[a].position;
+    uint8_t             position_b = table[b].position;
+    deferred_executor_t temp       = table[a];
+    table[a]                       = table[b];
+    table[b]                       = temp;
+    table[a].position              = position_a;
+    table[b].position              = position_b;
+
+    table[table[a].slot].position = a;
+    table[table[b].slot].position = b;
+}
+
+static size_t sift_up(deferred_executor_t *table, size_t position) {
+    while (position > 0) {
+        size_t parent = (position - 1) / 2;
+        if (!trigger_before(table[position].trigger_time, table[parent].trigger_time)) {
+            break;
         }
+        swap_executors(table, position, parent);
+        position = parent;
     }
-    return true;
+    return position;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static void sift_down(deferred_executor_t *table, size_t count, size_t position) {
+    for (;;) {
+        size_t earliest = position;
+        size_t left     = position * 2 + 1;
+        size_t right    = left + 1;
+        if (left < count && trigger_before(table[left].trigger_time, table[earliest].trigger_time)) {
+            earliest = left;
+        }
+        if (right < count && trigger_before(table[right].trigger_time, table[earliest].trigger_time)) {
+            earliest = right;
         }
+        if (earliest == position) {
+            return;
+        }
+        swap_executors(table, position, earliest);
+        position = earliest;
     }
-    return current_token;
+}
+
+static void reschedule_executor(deferred_executor_t *table, size_t table_count, size_t position) {
+    position = sift_up(table, position);
+    sift_down(table, active_count(table, table_count), position);
+}
+
+static void remove_executor(deferred_executor_t *table, size_t table_count, size_t position) {
+    size_t last = active_count(table, table_count) - 1;
+    swap_executors(table, position, last);
+
+    deferred_executor_t *entry = &table[last];
+    entry->token               = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time        = 0;
+    entry->callback            = NULL;
+    entry->cb_arg              = NULL;
+
+    if (position < last) {
+        reschedule_executor(table, table_count, position);
+    }
+}
+
+static inline bool is_due(deferred_executor_t *entry, uint32_t now) {
+    return ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0;
+}
+
+static void mark_due(deferred_executor_t *table, size_t count, size_t position, uint32_t now, uint8_t *marked) {
+    // Children never trigger before their parent, so stop descending at the first executor that isn't due
+    if (position >= count || !is_due(&table[position], now)) {
+        return;
+    }
+    marked[table[position].slot / 8] |= 1 << (table[position].slot % 8);
+    mark_due(table, count, position * 2 + 1, now, marked);
+    mark_due(table, count, position * 2 + 2, now, marked);
+}
+
+static int find_marked_due(deferred_executor_t *table, size_t count, size_t position, uint32_t now, const uint8_t *marked) {
+    // Returns the earliest executor in the subtree that is still due and marked, or -1
+    if (position >= count || !is_due(&table[position], now)) {
+        return -1;
+    }
+    if (marked[table[position].slot / 8] & (1 << (table[position].slot % 8))) {
+        return position;
+    }
+    int left  = find_marked_due(table, count, position * 2 + 1, now, marked);
+    int right = find_marked_due(table, count, position * 2 + 2, now, marked);
+    if (left < 0 || (right >= 0 && trigger_before(table[right].trigger_time, table[left].trigger_time))) {
+        return right;
+    }
+    return left;
 }
 
 //------------------------------------
@@ -45,31 +170,26 @@ static inline deferred_token allocate_token(deferred_executor_t *table, size_t t
 
 deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
     // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || !callback) {
+    if (!table || table_count == 0 || table_count > UINT8_MAX || delay_ms == 0 || !callback) {
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Claim the first free position, if there is one
+    init_slots(table, table_count);
+    size_t position = active_count(table, table_count);
+    if (position == table_count) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry
+    deferred_executor_t *entry = &table[position];
+    deferred_token       token = allocate_token(table_count, entry->slot);
+    entry->token               = token;
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    sift_up(table, position);
+    return token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +199,15 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    int position = find_token(table, table_count, token);
+    if (position < 0) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    table[position].trigger_time = timer_read32() + delay_ms;
+    reschedule_executor(table, table_count, position);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,20 +217,22 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    int position = find_token(table, table_count, token);
+    if (position < 0) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    remove_executor(table, table_count, position);
+    return true;
+}
+
+uint32_t deferred_exec_time_until_next_advanced(deferred_executor_t *table, size_t table_count) {
+    if (!table || table_count == 0 || table[0].token == INVALID_DEFERRED_TOKEN) {
+        return UINT32_MAX;
+    }
+    int32_t remaining = TIMER_DIFF_32(table[0].trigger_time, timer_read32());
+    return remaining > 0 ? remaining : 0;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,35 +242,48 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        // Nothing to do unless the earliest executor is due
+        if (table[0].token == INVALID_DEFERRED_TOKEN || !is_due(&table[0], now)) {
+            return;
+        }
+
+        // Only the executors that are due now get to run, each at most once, so that a callback which requeues
+        // itself into the past still lets the main loop progress
+        uint8_t marked[(UINT8_MAX + 7) / 8] = {0};
+        mark_due(table, active_count(table, table_count), 0, now, marked);
+
+        // Run them earliest first. The head of the heap is the next one, unless it's an executor that has
+        // already run during this pass and been requeued into the past.
+        for (;;) {
+            int position = find_marked_due(table, active_count(table, table_count), 0, now, marked);
+            if (position < 0) {
+                break;
+            }
+            deferred_executor_t *entry      = &table[position];
             deferred_token       curr_token = entry->token;
+            marked[entry->slot / 8] &= ~(1 << (entry->slot % 8));
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // The callback may have queued, extended or cancelled executors, so look this one up again. If it's gone,
+            // then the callback has canceled (and possibly re-queued) it. Skip further processing.
+            position = find_token(table, table_count, curr_token);
+            if (position < 0) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                table[position].trigger_time += delay_ms;
+                reschedule_executor(table, table_count, position);
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                remove_executor(table, table_count, position);
             }
         }
     }
@@ -172,6 +305,9 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+uint32_t deferred_exec_time_until_next(void) {
+    return deferred_exec_time_until_next_advanced(basic_executors, MAX_DEFERRED_EXECUTORS);
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
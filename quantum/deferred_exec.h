@@ -60,6 +60,13 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Determines how long it is until the next deferred execution is due, so that idle code can sleep until then.
+ *
+ * @return the number of milliseconds until the next callback is invoked, zero if one is already due, or UINT32_MAX if none are queued
+ */
+uint32_t deferred_exec_time_until_next(void);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -72,10 +79,13 @@ void deferred_exec_task(void);
 /**
  * @struct Structure for containing self-hosted deferred executor tables.
  * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
- *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
+ *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in a
+ *        zero-initialised array of at most 255 items.
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
+    uint8_t                slot;     // the slot this executor's token maps to
+    uint8_t                position; // where the executor for this entry's slot currently is in the table
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
@@ -110,6 +120,15 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Determines how long it is until the next deferred execution in a custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @return the number of milliseconds until the next callback is invoked, zero if one is already due, or UINT32_MAX if none are queued
+ */
+uint32_t deferred_exec_time_until_next_advanced(deferred_executor_t *table, size_t table_count);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
@@ -18,6 +18,7 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "send_string.h"
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
@@ -32,6 +33,20 @@
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+void dynamic_keymap_init(void) {
+    nvm_dynamic_keymap_init();
+}
+
+void dynamic_keymap_task(void) {
+    nvm_dynamic_keymap_flush(false);
+}
+
+void dynamic_keymap_flush(void) {
+    nvm_dynamic_keymap_flush(true);
+}
+#endif
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -42,6 +57,7 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+    resolved_keymap_cache_invalidate();
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -72,6 +88,9 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+
+    // Persist immediately, callers may rely on the keymap being in EEPROM before marking it valid.
+    nvm_dynamic_keymap_flush(true);
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
@@ -80,6 +99,7 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+    resolved_keymap_cache_invalidate();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
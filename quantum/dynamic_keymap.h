@@ -26,6 +26,13 @@
 #    define DYNAMIC_KEYMAP_MACRO_COUNT 16
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+// Loads the RAM mirror of the keymap, and writes back any pending changes once idle
+void dynamic_keymap_init(void);
+void dynamic_keymap_task(void);
+void dynamic_keymap_flush(void);
+#endif
+
 uint8_t  dynamic_keymap_get_layer_count(void);
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
 void     dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode);
@@ -0,0 +1,184 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "key_latency.h"
+#include "timer.h"
+#include "debug.h"
+#include "util.h"
+
+typedef struct {
+    uint32_t count;
+    uint32_t sum;
+    uint16_t min;
+    uint16_t max;
+    uint16_t histogram[KEY_LATENCY_BUCKETS];
+} key_latency_stats_t;
+
+static key_latency_stats_t key_latency_stats;
+static key_latency_mark_t  key_latency_current;
+
+key_latency_mark_t key_latency_begin(const keyevent_t *event) {
+    key_latency_mark_t previous = key_latency_current;
+
+    key_latency_current.edge_time = event->edge_time;
+    key_latency_current.pending   = true;
+    return previous;
+}
+
+void key_latency_end(key_latency_mark_t previous) {
+    key_latency_current = previous;
+}
+
+void key_latency_report_sent(void) {
+    if (!key_latency_current.pending) {
+        return;
+    }
+
+    // Only the first report caused by an event counts
+    key_latency_current.pending = false;
+    key_latency_record(TIMER_DIFF_16(timer_read(), key_latency_current.edge_time));
+}
+
+void key_latency_hold(key_latency_mark_t *held) {
+    if (!key_latency_current.pending) {
+        return;
+    }
+
+    // Keep the earliest edge, as that is the one waiting longest for the report
+    if (!held->pending || TIMER_DIFF_16(held->edge_time, key_latency_current.edge_time) < UINT16_MAX / 2) {
+        *held = key_latency_current;
+    }
+    key_latency_current.pending = false;
+}
+
+key_latency_mark_t key_latency_resume(key_latency_mark_t *held) {
+    key_latency_mark_t previous = key_latency_current;
+
+    key_latency_current = *held;
+    held->pending       = false;
+    return previous;
+}
+
+void key_latency_record(uint16_t latency) {
+    key_latency_stats_t *stats = &key_latency_stats;
+    if (stats->count == 0 || latency < stats->min) {
+        stats->min = latency;
+    }
+    if (latency > stats->max) {
+        stats->max = latency;
+    }
+    stats->count++;
+    stats->sum += latency;
+
+    // The last bin collects everything beyond the histogram
+    uint8_t bucket = MIN(latency / KEY_LATENCY_BUCKET_WIDTH, KEY_LATENCY_BUCKETS - 1);
+    if (stats->histogram[bucket] == UINT16_MAX) {
+        // Halve all bins, keeping their proportions
+        for (uint8_t i = 0; i < KEY_LATENCY_BUCKETS; i++) {
+            stats->histogram[i] >>= 1;
+        }
+    }
+    stats->histogram[bucket]++;
+}
+
+static uint16_t key_latency_p99(const key_latency_stats_t *stats) {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < KEY_LATENCY_BUCKETS; i++) {
+        total += stats->histogram[i];
+    }
+
+    // Find the first bin at which 99% of the samples have been seen
+    uint32_t threshold = (total * 99 + 99) / 100;
+    uint32_t seen      = 0;
+    for (uint8_t i = 0; i < KEY_LATENCY_BUCKETS - 1; i++) {
+        seen += stats->histogram[i];
+        if (seen >= threshold) {
+            uint32_t upper = (uint32_t)(i + 1) * KEY_LATENCY_BUCKET_WIDTH - 1;
+            return MIN(upper, stats->max);
+        }
+    }
+    return stats->max;
+}
+
+void key_latency_get(key_latency_summary_t *summary) {
+    const key_latency_stats_t *stats = &key_latency_stats;
+    summary->count                   = stats->count;
+    if (stats->count == 0) {
+        summary->min = summary->avg = summary->max = summary->p99 = 0;
+        return;
+    }
+
+    summary->min = stats->min;
+    summary->avg = stats->sum / stats->count;
+    summary->max = stats->max;
+    summary->p99 = key_latency_p99(stats);
+}
+
+uint16_t key_latency_get_bucket(uint8_t bucket) {
+    return bucket < KEY_LATENCY_BUCKETS ? key_latency_stats.histogram[bucket] : 0;
+}
+
+void key_latency_reset(void) {
+    memset(&key_latency_stats, 0, sizeof(key_latency_stats));
+}
+
+void key_latency_print(void) {
+    key_latency_summary_t summary;
+    key_latency_get(&summary);
+    dprintf("key latency (ms): count %lu min %u avg %u max %u p99 %u\n", (unsigned long)summary.count, summary.min, summary.avg, summary.max, summary.p99);
+    for (uint8_t i = 0; i < KEY_LATENCY_BUCKETS; i++) {
+        if (key_latency_stats.histogram[i] == 0) {
+            continue;
+        }
+        if (i == KEY_LATENCY_BUCKETS - 1) {
+            dprintf("  >= %4u: %u\n", i * KEY_LATENCY_BUCKET_WIDTH, key_latency_stats.histogram[i]);
+        } else {
+            dprintf("  %4u-%4u: %u\n", i * KEY_LATENCY_BUCKET_WIDTH, (i + 1) * KEY_LATENCY_BUCKET_WIDTH - 1, key_latency_stats.histogram[i]);
+        }
+    }
+}
+
+void key_latency_task(void) {
+#ifdef CONSOLE_ENABLE
+    static uint32_t last_report = 0;
+    static uint32_t last_count  = 0;
+    if (timer_elapsed32(last_report) >= KEY_LATENCY_REPORT_INTERVAL) {
+        last_report = timer_read32();
+        // Stay quiet while nothing is typed
+        if (key_latency_stats.count != last_count) {
+            last_count = key_latency_stats.count;
+            key_latency_print();
+        }
+    }
+#endif
+}
+
+static uint8_t key_latency_write_u16(uint8_t *data, uint16_t value) {
+    data[0] = (value >> 8) & 0xFF;
+    data[1] = value & 0xFF;
+    return 2;
+}
+
+uint8_t key_latency_serialize(uint8_t first_bucket, uint8_t *data, uint8_t length) {
+    if (length < KEY_LATENCY_SERIALIZED_HEADER_SIZE || first_bucket >= KEY_LATENCY_BUCKETS) {
+        return 0;
+    }
+
+    key_latency_summary_t summary;
+    key_latency_get(&summary);
+
+    uint8_t i = 0;
+    data[i++] = KEY_LATENCY_BUCKETS;
+    data[i++] = KEY_LATENCY_BUCKET_WIDTH;
+    i += key_latency_write_u16(&data[i], summary.count >> 16);
+    i += key_latency_write_u16(&data[i], summary.count & 0xFFFF);
+    i += key_latency_write_u16(&data[i], summary.min);
+    i += key_latency_write_u16(&data[i], summary.avg);
+    i += key_latency_write_u16(&data[i], summary.max);
+    i += key_latency_write_u16(&data[i], summary.p99);
+    for (uint8_t bucket = first_bucket; bucket < KEY_LATENCY_BUCKETS && i + 2 <= length; bucket++) {
+        i += key_latency_write_u16(&data[i], key_latency_stats.histogram[bucket]);
+    }
+    return i;
+}
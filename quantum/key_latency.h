@@ -0,0 +1,95 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    End-to-end key latency, from the switch edge to the keyboard report.
+
+    With KEY_LATENCY_ENABLE = yes, every key event carries the time its switch
+    edge was first seen by the matrix, before debouncing. When a keyboard report
+    is sent while that event is being processed, the elapsed time is added to a
+    histogram with KEY_LATENCY_BUCKET_WIDTH millisecond bins. Events held back
+    by tapping or combos are attributed once they are released, so the time a
+    mod-tap or combo spends waiting for its decision is part of the latency.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+
+typedef struct {
+    uint32_t count;
+    uint16_t min;
+    uint16_t avg;
+    uint16_t max;
+    uint16_t p99;
+} key_latency_summary_t;
+
+#ifdef KEY_LATENCY_ENABLE
+
+#    ifndef KEY_LATENCY_BUCKETS
+#        define KEY_LATENCY_BUCKETS 32
+#    endif
+
+#    ifndef KEY_LATENCY_BUCKET_WIDTH
+#        define KEY_LATENCY_BUCKET_WIDTH 1
+#    endif
+
+#    ifndef KEY_LATENCY_REPORT_INTERVAL
+#        define KEY_LATENCY_REPORT_INTERVAL 5000
+#    endif
+
+// Size of the raw HID response header written by key_latency_serialize()
+#    define KEY_LATENCY_SERIALIZED_HEADER_SIZE 14
+
+typedef struct {
+    uint16_t edge_time;
+    bool     pending;
+} key_latency_mark_t;
+
+/**
+ * \brief Starts attributing reports to an event.
+ *
+ * \return the previous attribution, to be restored by key_latency_end()
+ */
+key_latency_mark_t key_latency_begin(const keyevent_t *event);
+void               key_latency_end(key_latency_mark_t previous);
+
+/**
+ * \brief Records the latency of the current event, if any, once a report is sent.
+ */
+void key_latency_report_sent(void);
+
+/**
+ * \brief Moves the current attribution, if any, to a report that is sent later.
+ *
+ * `held` keeps the earliest edge of everything handed over until it is resumed.
+ */
+void key_latency_hold(key_latency_mark_t *held);
+
+/**
+ * \brief Makes the attribution stored by key_latency_hold() current again, right before sending its report.
+ *
+ * \return the previous attribution, to be restored by key_latency_end()
+ */
+key_latency_mark_t key_latency_resume(key_latency_mark_t *held);
+
+void     key_latency_record(uint16_t latency);
+void     key_latency_get(key_latency_summary_t *summary);
+uint16_t key_latency_get_bucket(uint8_t bucket);
+void     key_latency_reset(void);
+void     key_latency_print(void);
+void     key_latency_task(void);
+
+/**
+ * \brief Writes the latency summary and part of the histogram as big-endian values, for raw HID.
+ *
+ * Layout: bucket count, bucket width, then count (32-bit), min, avg, max and
+ * p99 (16-bit), followed by as many 16-bit bucket counts as fit, starting at
+ * the given bucket.
+ *
+ * \return number of bytes written, 0 if the bucket or buffer is invalid
+ */
+uint8_t key_latency_serialize(uint8_t first_bucket, uint8_t *data, uint8_t length);
+
+#endif // KEY_LATENCY_ENABLE
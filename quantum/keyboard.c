@@ -32,6 +32,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "action_util.h"
+#include "task_profiler.h"
+#ifdef KEY_LATENCY_ENABLE
+#    include "key_latency.h"
+#endif
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -107,9 +112,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_WRITE_BACK)
+#    include "wear_leveling.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -468,6 +479,9 @@ void keyboard_init(void) {
 #endif
     matrix_init();
     quantum_init();
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_MIRROR)
+    dynamic_keymap_init();
+#endif
 #ifdef CONNECTION_ENABLE
     connection_init();
 #endif
@@ -563,6 +577,16 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
 #endif
 }
 
+#ifdef KEY_LATENCY_ENABLE
+/** \brief Time the switch edge on a row was observed
+ *
+ * Custom matrix implementations without edge tracking report the scan time.
+ */
+__attribute__((weak)) uint16_t matrix_get_edge_time(uint8_t row) {
+    return timer_read();
+}
+#endif
+
 /**
  * @brief Generates a tick event at a maximum rate of 1KHz that drives the
  * internal QMK state machine.
@@ -625,7 +649,13 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
+#ifdef KEY_LATENCY_ENABLE
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+                    event.edge_time  = matrix_get_edge_time(row);
+                    action_exec(event);
+#else
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+#endif
                 }
 
                 switch_events(row, col, key_pressed);
@@ -700,6 +730,14 @@ void quantum_task(void) {
     dip_switch_task();
 #endif
 
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_MIRROR)
+    dynamic_keymap_task();
+#endif
+
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_WRITE_BACK)
+    wear_leveling_task();
+#endif
+
 #ifdef AUTO_SHIFT_ENABLE
     autoshift_matrix_scan();
 #endif
@@ -720,50 +758,56 @@ void quantum_task(void) {
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    bool                         matrix_changed;
+    TASK_PROFILE(TASK_PROFILER_MATRIX, matrix_changed = matrix_task());
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    TASK_PROFILE(TASK_PROFILER_QUANTUM, quantum_task());
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
-    split_watchdog_task();
+    TASK_PROFILE(TASK_PROFILER_SPLIT_WATCHDOG, split_watchdog_task());
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    TASK_PROFILE(TASK_PROFILER_RGBLIGHT, rgblight_task());
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    TASK_PROFILE(TASK_PROFILER_LED_MATRIX, led_matrix_task());
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    TASK_PROFILE(TASK_PROFILER_RGB_MATRIX, rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
-    backlight_task();
+    TASK_PROFILE(TASK_PROFILER_BACKLIGHT, backlight_task());
 #    endif
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    bool encoder_changed;
+    TASK_PROFILE(TASK_PROFILER_ENCODER, encoder_changed = encoder_task());
+    if (encoder_changed) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    bool pointing_device_changed;
+    TASK_PROFILE(TASK_PROFILER_POINTING_DEVICE, pointing_device_changed = pointing_device_task());
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    TASK_PROFILE(TASK_PROFILER_OLED, oled_task());
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -771,7 +815,7 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    TASK_PROFILE(TASK_PROFILER_ST7565, st7565_task());
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
@@ -780,36 +824,49 @@ void keyboard_task(void) {
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
-    mousekey_task();
+    TASK_PROFILE(TASK_PROFILER_MOUSEKEY, mousekey_task());
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_task();
+    TASK_PROFILE(TASK_PROFILER_PS2_MOUSE, ps2_mouse_task());
 #endif
 
 #ifdef MIDI_ENABLE
-    midi_task();
+    TASK_PROFILE(TASK_PROFILER_MIDI, midi_task());
 #endif
 
 #ifdef JOYSTICK_ENABLE
-    joystick_task();
+    TASK_PROFILE(TASK_PROFILER_JOYSTICK, joystick_task());
 #endif
 
 #ifdef BATTERY_DRIVER
-    battery_task();
+    TASK_PROFILE(TASK_PROFILER_BATTERY, battery_task());
 #endif
 
 #ifdef BLUETOOTH_ENABLE
-    bluetooth_task();
+    TASK_PROFILE(TASK_PROFILER_BLUETOOTH, bluetooth_task());
 #endif
 
 #ifdef HAPTIC_ENABLE
-    haptic_task();
+    TASK_PROFILE(TASK_PROFILER_HAPTIC, haptic_task());
 #endif
 
-    led_task();
+    TASK_PROFILE(TASK_PROFILER_LED, led_task());
 
 #ifdef OS_DETECTION_ENABLE
-    os_detection_task();
+    TASK_PROFILE(TASK_PROFILER_OS_DETECTION, os_detection_task());
+#endif
+
+#ifdef COALESCE_KEYBOARD_REPORTS
+    // Send everything that changed during this scan as a single report
+    flush_keyboard_report();
+#endif
+
+#ifdef TASK_PROFILER_ENABLE
+    task_profiler_task();
+#endif
+
+#ifdef KEY_LATENCY_ENABLE
+    key_latency_task();
 #endif
 }
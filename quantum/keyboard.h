@@ -40,6 +40,9 @@ typedef struct {
     uint16_t        time;
     keyevent_type_t type;
     bool            pressed;
+#ifdef KEY_LATENCY_ENABLE
+    uint16_t edge_time; // when the switch edge was first observed, before debouncing
+#endif
 } keyevent_t;
 
 /* equivalent test of keypos_t */
@@ -74,7 +77,11 @@ static inline bool IS_DIPSWITCHEVENT(const keyevent_t event) {
 #define MAKE_KEYPOS(row_num, col_num) ((keypos_t){.row = (row_num), .col = (col_num)})
 
 /* Common keyevent_t object factory */
-#define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type)})
+#ifdef KEY_LATENCY_ENABLE
+#    define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type), .edge_time = timer_read()})
+#else
+#    define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type)})
+#endif
 
 /**
  * @brief Constructs a key event for a pressed or released key.
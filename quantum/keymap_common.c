@@ -48,7 +48,7 @@ extern keymap_config_t keymap_config;
 /* converts key to action */
 action_t action_for_key(uint8_t layer, keypos_t key) {
     // 16bit keycodes - important
-    uint16_t keycode = keymap_key_to_keycode(layer, key);
+    uint16_t keycode = resolved_keymap_cache_keycode(layer, key);
     return action_for_keycode(keycode);
 };
 
@@ -20,7 +20,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "util.h"
 #include "matrix.h"
 #include "debounce.h"
+#include "compiler_support.h"
 #include "atomic_util.h"
+#ifdef MATRIX_WAKEUP_ENABLE
+#    include "matrix_wakeup.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -31,6 +35,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define ROWS_PER_HAND (MATRIX_ROWS)
 #endif
 
+STATIC_ASSERT(ROWS_PER_HAND <= DEBOUNCE_NUM_ROWS, "DEBOUNCE_NUM_ROWS must cover every row scanned by this half");
+
 #ifdef DIRECT_PINS_RIGHT
 #    define SPLIT_MUTABLE
 #else
@@ -76,6 +82,12 @@ __attribute__((weak)) void matrix_init_pins(void);
 __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row);
 __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[], uint8_t current_col, matrix_row_t row_shifter);
 
+#ifdef MATRIX_WAKEUP_ENABLE
+// platform overridable functions, calling matrix_wakeup_signal() when the pin changes
+__attribute__((weak)) void matrix_wakeup_pin_enable(pin_t pin) {}
+__attribute__((weak)) void matrix_wakeup_pin_disable(pin_t pin) {}
+#endif
+
 static inline void gpio_atomic_set_pin_output_low(pin_t pin) {
     ATOMIC_BLOCK_FORCEON {
         gpio_set_pin_output(pin);
@@ -133,6 +145,39 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#    ifdef MATRIX_WAKEUP_ENABLE
+__attribute__((weak)) void matrix_wakeup_arm_pins(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (direct_pins[row][col] != NO_PIN) {
+                matrix_wakeup_pin_enable(direct_pins[row][col]);
+            }
+        }
+    }
+}
+
+__attribute__((weak)) void matrix_wakeup_disarm_pins(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (direct_pins[row][col] != NO_PIN) {
+                matrix_wakeup_pin_disable(direct_pins[row][col]);
+            }
+        }
+    }
+}
+
+__attribute__((weak)) bool matrix_wakeup_pins_active(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (direct_pins[row][col] != NO_PIN && readMatrixPin(direct_pins[row][col]) == 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+#    endif // MATRIX_WAKEUP_ENABLE
+
 #elif defined(DIODE_DIRECTION)
 #    if defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
 #        if (DIODE_DIRECTION == COL2ROW)
@@ -198,6 +243,40 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#            ifdef MATRIX_WAKEUP_ENABLE
+// Select every row, so any key pressed pulls its col low
+__attribute__((weak)) void matrix_wakeup_arm_pins(void) {
+    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+        select_row(x);
+    }
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        if (col_pins[x] != NO_PIN) {
+            matrix_wakeup_pin_enable(col_pins[x]);
+        }
+    }
+    matrix_output_select_delay();
+}
+
+__attribute__((weak)) void matrix_wakeup_disarm_pins(void) {
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        if (col_pins[x] != NO_PIN) {
+            matrix_wakeup_pin_disable(col_pins[x]);
+        }
+    }
+    unselect_rows();
+    matrix_output_unselect_delay(0, true);
+}
+
+__attribute__((weak)) bool matrix_wakeup_pins_active(void) {
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        if (col_pins[x] != NO_PIN && readMatrixPin(col_pins[x]) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+#            endif // MATRIX_WAKEUP_ENABLE
+
 #        elif (DIODE_DIRECTION == ROW2COL)
 
 static bool select_col(uint8_t col) {
@@ -262,6 +341,40 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     matrix_output_unselect_delay(current_col, key_pressed); // wait for all Row signals to go HIGH
 }
 
+#            ifdef MATRIX_WAKEUP_ENABLE
+// Select every col, so any key pressed pulls its row low
+__attribute__((weak)) void matrix_wakeup_arm_pins(void) {
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        select_col(x);
+    }
+    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+        if (row_pins[x] != NO_PIN) {
+            matrix_wakeup_pin_enable(row_pins[x]);
+        }
+    }
+    matrix_output_select_delay();
+}
+
+__attribute__((weak)) void matrix_wakeup_disarm_pins(void) {
+    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+        if (row_pins[x] != NO_PIN) {
+            matrix_wakeup_pin_disable(row_pins[x]);
+        }
+    }
+    unselect_cols();
+    matrix_output_unselect_delay(0, true);
+}
+
+__attribute__((weak)) bool matrix_wakeup_pins_active(void) {
+    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+        if (row_pins[x] != NO_PIN && readMatrixPin(row_pins[x]) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+#            endif // MATRIX_WAKEUP_ENABLE
+
 #        else
 #            error DIODE_DIRECTION must be one of COL2ROW or ROW2COL!
 #        endif
@@ -320,9 +433,7 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
-uint8_t matrix_scan(void) {
-    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
-
+static void matrix_read(matrix_row_t curr_matrix[]) {
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
@@ -335,10 +446,41 @@ uint8_t matrix_scan(void) {
         matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
     }
 #endif
+}
+
+uint8_t matrix_scan(void) {
+    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
+
+#ifdef MATRIX_WAKEUP_ENABLE
+    // While armed nothing is pressed, so an empty matrix is the current state
+    if (matrix_wakeup_scan_needed()) {
+        matrix_read(curr_matrix);
+    }
+#else
+    matrix_read(curr_matrix);
+#endif
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
 
+#ifdef MATRIX_WAKEUP_ENABLE
+    if (!matrix_wakeup_is_armed()) {
+        bool active = changed;
+        for (uint8_t row = 0; row < ROWS_PER_HAND && !active; row++) {
+            active = curr_matrix[row] != 0;
+        }
+        matrix_wakeup_task(active);
+    }
+#endif
+
+#ifdef KEY_LATENCY_ENABLE
+#    ifdef SPLIT_KEYBOARD
+    matrix_edge_track(raw_matrix, matrix + thisHand, ROWS_PER_HAND);
+#    else
+    matrix_edge_track(raw_matrix, matrix, ROWS_PER_HAND);
+#    endif
+#endif
+
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
 #else
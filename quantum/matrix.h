@@ -75,6 +75,13 @@ void matrix_scan_kb(void);
 void matrix_init_user(void);
 void matrix_scan_user(void);
 
+#ifdef KEY_LATENCY_ENABLE
+/* record when raw rows first diverge from their debounced state */
+void matrix_edge_track(const matrix_row_t raw[], const matrix_row_t debounced[], uint8_t num_rows);
+/* time the pending change on a row was first observed, before debouncing */
+uint16_t matrix_get_edge_time(uint8_t row);
+#endif
+
 #ifdef SPLIT_KEYBOARD
 bool matrix_post_scan(void);
 void matrix_slave_scan_kb(void);
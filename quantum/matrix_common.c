@@ -1,8 +1,11 @@
 #include "matrix.h"
 #include "debounce.h"
+#include "compiler_support.h"
 #include "wait.h"
 #include "print.h"
 #include "debug.h"
+#include "timer.h"
+#include "task_profiler.h"
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -14,6 +17,8 @@
 #    define ROWS_PER_HAND (MATRIX_ROWS)
 #endif
 
+STATIC_ASSERT(ROWS_PER_HAND <= DEBOUNCE_NUM_ROWS, "DEBOUNCE_NUM_ROWS must cover every row scanned by this half");
+
 #ifndef MATRIX_IO_DELAY
 #    define MATRIX_IO_DELAY 30
 #endif
@@ -31,6 +36,12 @@ uint8_t thisHand, thatHand;
 extern const matrix_row_t matrix_mask[];
 #endif
 
+#ifdef KEY_LATENCY_ENABLE
+// time each local row first departed from its debounced state
+static uint16_t matrix_edge_time[ROWS_PER_HAND];
+static bool     matrix_edge_pending[ROWS_PER_HAND];
+#endif
+
 // user-defined overridable functions
 
 __attribute__((weak)) void matrix_init_kb(void) {
@@ -69,6 +80,35 @@ inline matrix_row_t matrix_get_row(uint8_t row) {
 #endif
 }
 
+#ifdef KEY_LATENCY_ENABLE
+void matrix_edge_track(const matrix_row_t raw[], const matrix_row_t debounced[], uint8_t num_rows) {
+    const uint16_t now = timer_read();
+    for (uint8_t row = 0; row < num_rows; row++) {
+        if (raw[row] == debounced[row]) {
+            matrix_edge_pending[row] = false;
+        } else if (!matrix_edge_pending[row]) {
+            matrix_edge_time[row]    = now;
+            matrix_edge_pending[row] = true;
+        }
+    }
+}
+
+uint16_t matrix_get_edge_time(uint8_t row) {
+#    ifdef SPLIT_KEYBOARD
+    // rows from the other half only become visible once transported
+    if (row < thisHand || row >= thisHand + ROWS_PER_HAND) {
+#        if defined(SPLIT_MATRIX_DELTA) && defined(SPLIT_COMMON_TRANSACTIONS)
+        return transactions_slave_edge_time(row - thatHand);
+#        else
+        return timer_read();
+#        endif
+    }
+    row -= thisHand;
+#    endif
+    return matrix_edge_pending[row] ? matrix_edge_time[row] : timer_read();
+}
+#endif
+
 #if (MATRIX_COLS <= 8)
 #    define print_matrix_header() print("\nr/c 01234567\n")
 #    define print_matrix_row(row) print_bin_reverse8(matrix_get_row(row))
@@ -97,7 +137,9 @@ bool matrix_post_scan(void) {
     if (is_keyboard_master()) {
         static bool  last_connected              = false;
         matrix_row_t slave_matrix[ROWS_PER_HAND] = {0};
-        if (transport_master_if_connected(matrix + thisHand, slave_matrix)) {
+        bool connected;
+        TASK_PROFILE(TASK_PROFILER_SPLIT_TRANSPORT, connected = transport_master_if_connected(matrix + thisHand, slave_matrix));
+        if (connected) {
             changed = memcmp(matrix + thatHand, slave_matrix, sizeof(slave_matrix)) != 0;
 
             last_connected = true;
@@ -113,7 +155,7 @@ bool matrix_post_scan(void) {
 
         matrix_scan_kb();
     } else {
-        transport_slave(matrix + thatHand, matrix + thisHand);
+        TASK_PROFILE(TASK_PROFILER_SPLIT_TRANSPORT, transport_slave(matrix + thatHand, matrix + thisHand));
 
         matrix_slave_scan_kb();
     }
@@ -168,6 +210,14 @@ __attribute__((weak)) void matrix_init(void) {
 __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
 
+#ifdef KEY_LATENCY_ENABLE
+#    ifdef SPLIT_KEYBOARD
+    matrix_edge_track(raw_matrix, matrix + thisHand, ROWS_PER_HAND);
+#    else
+    matrix_edge_track(raw_matrix, matrix, ROWS_PER_HAND);
+#    endif
+#endif
+
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
 #else
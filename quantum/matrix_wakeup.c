@@ -0,0 +1,84 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "matrix_wakeup.h"
+#include "timer.h"
+#include "util.h"
+
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
+
+#ifdef SPLIT_KEYBOARD
+#    include "keyboard.h"
+#    include "split_common/split_util.h"
+#endif
+
+static volatile bool matrix_wakeup_pending = false;
+static bool          matrix_wakeup_armed   = false;
+static uint32_t      matrix_wakeup_last_activity;
+
+__attribute__((weak)) void matrix_wakeup_wait(uint32_t timeout_ms) {}
+
+void matrix_wakeup_signal(void) {
+    matrix_wakeup_pending = true;
+}
+
+bool matrix_wakeup_is_armed(void) {
+    return matrix_wakeup_armed;
+}
+
+#if MATRIX_WAKEUP_SLEEP_TIMEOUT > 0
+static bool matrix_wakeup_may_sleep(void) {
+#    ifdef SPLIT_KEYBOARD
+    // The master reads the other half over the transport after scanning, so sleeping would hold back its presses
+    if (is_keyboard_master() && is_transport_connected()) {
+        return false;
+    }
+#    endif
+    return true;
+}
+#endif
+
+bool matrix_wakeup_scan_needed(void) {
+    if (!matrix_wakeup_armed) {
+        return true;
+    }
+
+#if MATRIX_WAKEUP_SLEEP_TIMEOUT > 0
+    if (!matrix_wakeup_pending && matrix_wakeup_may_sleep()) {
+        uint32_t timeout = MATRIX_WAKEUP_SLEEP_TIMEOUT;
+#    ifdef DEFERRED_EXEC_ENABLE
+        // Wake up in time for the next deferred callback
+        timeout = MIN(timeout, deferred_exec_time_until_next());
+#    endif
+        if (timeout > 0) {
+            matrix_wakeup_wait(timeout);
+        }
+    }
+#endif
+
+    // Platforms without pin interrupts rely on polling the armed inputs
+    if (!matrix_wakeup_pending && !matrix_wakeup_pins_active()) {
+        return false;
+    }
+
+    matrix_wakeup_disarm_pins();
+    matrix_wakeup_armed         = false;
+    matrix_wakeup_pending       = false;
+    matrix_wakeup_last_activity = timer_read32();
+    return true;
+}
+
+void matrix_wakeup_task(bool active) {
+    if (active) {
+        matrix_wakeup_last_activity = timer_read32();
+        return;
+    }
+
+    if (!matrix_wakeup_armed && timer_elapsed32(matrix_wakeup_last_activity) >= MATRIX_WAKEUP_IDLE_TIMEOUT) {
+        matrix_wakeup_pending = false;
+        matrix_wakeup_arm_pins();
+        matrix_wakeup_armed = true;
+    }
+}
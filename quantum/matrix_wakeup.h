@@ -0,0 +1,55 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Event driven matrix scanning.
+ *
+ * Once nothing has been pressed for MATRIX_WAKEUP_IDLE_TIMEOUT milliseconds, all
+ * outputs of the matrix are driven and its inputs are armed, so a single read
+ * (or a pin interrupt) can tell whether any key moved. Full scanning resumes as
+ * soon as that happens.
+ */
+
+#ifndef MATRIX_WAKEUP_IDLE_TIMEOUT
+#    define MATRIX_WAKEUP_IDLE_TIMEOUT 500
+#endif
+
+// Maximum time in milliseconds to sleep per scan while armed, 0 to never sleep
+#ifndef MATRIX_WAKEUP_SLEEP_TIMEOUT
+#    define MATRIX_WAKEUP_SLEEP_TIMEOUT 0
+#endif
+
+/**
+ * \brief Called by matrix implementations before reading the matrix.
+ *
+ * \return false if the matrix is armed and nothing has moved, in which case the previous state is still valid
+ */
+bool matrix_wakeup_scan_needed(void);
+
+/**
+ * \brief Called by matrix implementations after reading the matrix.
+ *
+ * \param active true if the raw matrix changed or any key is held
+ */
+void matrix_wakeup_task(bool active);
+
+bool matrix_wakeup_is_armed(void);
+
+/**
+ * \brief Wakes up the matrix, safe to call from interrupt context.
+ */
+void matrix_wakeup_signal(void);
+
+// Matrix hooks: drive all outputs and arm the inputs, undo that, and check whether any input reads as pressed.
+// Implemented by quantum/matrix.c; custom matrices have to provide their own.
+void matrix_wakeup_arm_pins(void);
+void matrix_wakeup_disarm_pins(void);
+bool matrix_wakeup_pins_active(void);
+
+// Platform hook: sleep until matrix_wakeup_signal() is called or the timeout expires.
+// Pin change interrupts are set up through matrix_wakeup_pin_enable()/matrix_wakeup_pin_disable(), see quantum/matrix.c.
+void matrix_wakeup_wait(uint32_t timeout_ms);
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 3
+
+#define MATRIX_WAKEUP_IDLE_TIMEOUT 100
+#define MATRIX_WAKEUP_SLEEP_TIMEOUT 20
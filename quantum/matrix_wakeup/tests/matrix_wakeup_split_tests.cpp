@@ -0,0 +1,91 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix_wakeup.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+static bool     keyboard_master;
+static bool     transport_connected;
+static uint32_t sleeps;
+
+extern "C" {
+bool is_keyboard_master(void) {
+    return keyboard_master;
+}
+
+bool is_transport_connected(void) {
+    return transport_connected;
+}
+
+void matrix_wakeup_wait(uint32_t timeout_ms) {
+    sleeps++;
+}
+
+void matrix_wakeup_arm_pins(void) {}
+
+void matrix_wakeup_disarm_pins(void) {}
+
+bool matrix_wakeup_pins_active(void) {
+    return false;
+}
+}
+
+class MatrixWakeupSplit : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        sleeps = 0;
+        // The wakeup state outlives each test, start from a scanning matrix
+        if (matrix_wakeup_is_armed()) {
+            matrix_wakeup_signal();
+            matrix_wakeup_scan_needed();
+        }
+        matrix_wakeup_task(true);
+    }
+
+    void idle_until_armed() {
+        for (uint32_t i = 0; i <= MATRIX_WAKEUP_IDLE_TIMEOUT; i++) {
+            matrix_wakeup_scan_needed();
+            matrix_wakeup_task(false);
+            advance_time(1);
+        }
+        ASSERT_TRUE(matrix_wakeup_is_armed());
+    }
+};
+
+TEST_F(MatrixWakeupSplit, ConnectedMasterDoesNotSleep) {
+    keyboard_master     = true;
+    transport_connected = true;
+    idle_until_armed();
+
+    sleeps = 0;
+    EXPECT_FALSE(matrix_wakeup_scan_needed());
+    EXPECT_EQ(sleeps, 0);
+}
+
+TEST_F(MatrixWakeupSplit, DisconnectedMasterSleeps) {
+    keyboard_master     = true;
+    transport_connected = false;
+    idle_until_armed();
+
+    sleeps = 0;
+    EXPECT_FALSE(matrix_wakeup_scan_needed());
+    EXPECT_EQ(sleeps, 1);
+}
+
+TEST_F(MatrixWakeupSplit, SlaveSleeps) {
+    keyboard_master     = false;
+    transport_connected = true;
+    idle_until_armed();
+
+    sleeps = 0;
+    EXPECT_FALSE(matrix_wakeup_scan_needed());
+    EXPECT_EQ(sleeps, 1);
+}
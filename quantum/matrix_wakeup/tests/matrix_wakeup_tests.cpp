@@ -0,0 +1,100 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "matrix_wakeup.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+class MatrixWakeupPins : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_reset();
+        set_time(0);
+        matrix_init();
+        // The wakeup state outlives each test, start from a scanning matrix
+        if (matrix_wakeup_is_armed()) {
+            matrix_wakeup_signal();
+            matrix_scan();
+        }
+    }
+
+    void scan_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            matrix_scan();
+            advance_time(1);
+        }
+    }
+
+    void arm() {
+        scan_for(MATRIX_WAKEUP_IDLE_TIMEOUT + 1);
+        ASSERT_TRUE(matrix_wakeup_is_armed());
+    }
+};
+
+TEST_F(MatrixWakeupPins, ArmingDrivesRowsAndEnablesCols) {
+    arm();
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_TRUE(mock_pin_is_driven_low(row_pins[row]));
+    }
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] != NO_PIN) {
+            EXPECT_TRUE(mock_pin_wakeup_enabled(col_pins[col]));
+        }
+    }
+    EXPECT_FALSE(mock_invalid_pin_used());
+}
+
+TEST_F(MatrixWakeupPins, StaysArmedWhileNothingIsPressed) {
+    arm();
+
+    scan_for(MATRIX_WAKEUP_IDLE_TIMEOUT * 2);
+    EXPECT_TRUE(matrix_wakeup_is_armed());
+    EXPECT_FALSE(mock_invalid_pin_used());
+}
+
+TEST_F(MatrixWakeupPins, PolledPressWakesMatrixInSameScan) {
+    arm();
+
+    // No interrupt, the press is only seen by reading the armed cols
+    mock_set_switch(1, 2, true);
+    matrix_scan();
+    EXPECT_FALSE(matrix_wakeup_is_armed());
+    EXPECT_EQ(matrix_get_row(0), 0);
+    EXPECT_EQ(matrix_get_row(1), 1 << 2);
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_FALSE(mock_pin_is_driven_low(row_pins[row]));
+    }
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] != NO_PIN) {
+            EXPECT_FALSE(mock_pin_wakeup_enabled(col_pins[col]));
+        }
+    }
+
+    mock_set_switch(1, 2, false);
+    matrix_scan();
+    EXPECT_EQ(matrix_get_row(1), 0);
+    EXPECT_FALSE(mock_invalid_pin_used());
+}
+
+TEST_F(MatrixWakeupPins, HeldKeyKeepsMatrixScanning) {
+    mock_set_switch(0, 0, true);
+    scan_for(MATRIX_WAKEUP_IDLE_TIMEOUT * 2);
+    EXPECT_FALSE(matrix_wakeup_is_armed());
+    EXPECT_EQ(matrix_get_row(0), 1);
+
+    mock_set_switch(0, 0, false);
+    arm();
+    EXPECT_EQ(matrix_get_row(0), 0);
+}
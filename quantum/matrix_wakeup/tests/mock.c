@@ -0,0 +1,108 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "matrix.h"
+#include "pin_defs.h"
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+static bool pin_is_output[MOCK_PIN_COUNT];
+static bool pin_level[MOCK_PIN_COUNT];
+static bool pin_wakeup[MOCK_PIN_COUNT];
+static bool switches[MATRIX_ROWS][MATRIX_COLS];
+static bool invalid_pin_used;
+
+matrix_row_t raw_matrix[MATRIX_ROWS];
+matrix_row_t matrix[MATRIX_ROWS];
+
+static bool check_pin(pin_t pin) {
+    if (pin >= MOCK_PIN_COUNT) {
+        invalid_pin_used = true;
+        return false;
+    }
+    return true;
+}
+
+void mock_set_pin_input_high(pin_t pin) {
+    if (check_pin(pin)) {
+        pin_is_output[pin] = false;
+        pin_level[pin]     = true;
+    }
+}
+
+void mock_set_pin_output(pin_t pin) {
+    if (check_pin(pin)) {
+        pin_is_output[pin] = true;
+    }
+}
+
+void mock_write_pin(pin_t pin, bool level) {
+    if (check_pin(pin)) {
+        pin_level[pin] = level;
+    }
+}
+
+bool mock_read_pin(pin_t pin) {
+    if (!check_pin(pin)) {
+        return true;
+    }
+    // A pressed switch connects its col to its row, pulling the col low while the row is selected
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (switches[row][col] && col_pins[col] == pin && mock_pin_is_driven_low(row_pins[row])) {
+                return false;
+            }
+        }
+    }
+    return pin_level[pin];
+}
+
+void mock_reset(void) {
+    memset(pin_is_output, 0, sizeof(pin_is_output));
+    memset(pin_level, 0, sizeof(pin_level));
+    memset(pin_wakeup, 0, sizeof(pin_wakeup));
+    memset(switches, 0, sizeof(switches));
+    invalid_pin_used = false;
+}
+
+void mock_set_switch(uint8_t row, uint8_t col, bool pressed) {
+    switches[row][col] = pressed;
+}
+
+bool mock_pin_is_driven_low(pin_t pin) {
+    return check_pin(pin) && pin_is_output[pin] && !pin_level[pin];
+}
+
+bool mock_pin_wakeup_enabled(pin_t pin) {
+    return check_pin(pin) && pin_wakeup[pin];
+}
+
+bool mock_invalid_pin_used(void) {
+    return invalid_pin_used;
+}
+
+void matrix_wakeup_pin_enable(pin_t pin) {
+    if (check_pin(pin)) {
+        pin_wakeup[pin] = true;
+    }
+}
+
+void matrix_wakeup_pin_disable(pin_t pin) {
+    if (check_pin(pin)) {
+        pin_wakeup[pin] = false;
+    }
+}
+
+matrix_row_t matrix_get_row(uint8_t row) {
+    return matrix[row];
+}
+
+void matrix_output_select_delay(void) {}
+
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+
+void matrix_init_kb(void) {}
+
+void matrix_scan_kb(void) {}
@@ -0,0 +1,28 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t pin_t;
+
+#define MOCK_PIN_COUNT 8
+
+#define gpio_set_pin_input_high(pin) mock_set_pin_input_high(pin)
+#define gpio_set_pin_output(pin) mock_set_pin_output(pin)
+#define gpio_write_pin_low(pin) mock_write_pin(pin, false)
+#define gpio_write_pin_high(pin) mock_write_pin(pin, true)
+#define gpio_read_pin(pin) mock_read_pin(pin)
+
+void mock_set_pin_input_high(pin_t pin);
+void mock_set_pin_output(pin_t pin);
+void mock_write_pin(pin_t pin, bool level);
+bool mock_read_pin(pin_t pin);
+
+// Simulated switches, and what the matrix code did with the pins
+void mock_reset(void);
+void mock_set_switch(uint8_t row, uint8_t col, bool pressed);
+bool mock_pin_is_driven_low(pin_t pin);
+bool mock_pin_wakeup_enabled(pin_t pin);
+bool mock_invalid_pin_used(void);
@@ -0,0 +1,22 @@
+matrix_wakeup_pins_DEFS := -DMATRIX_WAKEUP_ENABLE -DIGNORE_ATOMIC_BLOCK
+matrix_wakeup_pins_CONFIG := $(QUANTUM_PATH)/matrix_wakeup/tests/config_mock.h
+
+# Same link order as common_features.mk, so weak hooks resolve as they do in firmware
+matrix_wakeup_pins_SRC := \
+	$(QUANTUM_PATH)/matrix_wakeup/tests/mock.c \
+	$(QUANTUM_PATH)/matrix_wakeup/tests/matrix_wakeup_tests.cpp \
+	$(QUANTUM_PATH)/matrix_wakeup.c \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+# Only the sleep decision, with the split and matrix hooks stubbed out by the test
+matrix_wakeup_split_DEFS := -DMATRIX_WAKEUP_ENABLE -DSPLIT_KEYBOARD
+matrix_wakeup_split_CONFIG := $(QUANTUM_PATH)/matrix_wakeup/tests/config_split_mock.h
+
+matrix_wakeup_split_SRC := \
+	$(QUANTUM_PATH)/matrix_wakeup/tests/matrix_wakeup_split_tests.cpp \
+	$(QUANTUM_PATH)/matrix_wakeup.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -0,0 +1 @@
+TEST_LIST += matrix_wakeup_pins matrix_wakeup_split
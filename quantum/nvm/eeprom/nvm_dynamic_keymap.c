@@ -1,6 +1,7 @@
 // Copyright 2024 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "compiler_support.h"
 #include "keycodes.h"
 #include "eeprom.h"
@@ -68,10 +69,91 @@ STATIC_ASSERT((int64_t)(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (int64_t)(DYNAMIC_KEYM
 #    define DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE (DYNAMIC_KEYMAP_EEPROM_MAX_ADDR - DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + 1)
 #endif
 
+#define DYNAMIC_KEYMAP_EEPROM_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+#    include "timer.h"
+
+// Size of the chunks the mirror is written back to EEPROM in
+#    ifndef DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_SIZE
+#        define DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_SIZE 32
+#    endif
+// Time in milliseconds without further changes before dirty blocks are written back
+#    ifndef DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY
+#        define DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY 1000
+#    endif
+
+#    define DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_COUNT ((DYNAMIC_KEYMAP_EEPROM_SIZE + DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_SIZE - 1) / DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_SIZE)
+
+// Big endian copy of the keymap region of the EEPROM
+static uint8_t  dynamic_keymap_mirror[DYNAMIC_KEYMAP_EEPROM_SIZE];
+static uint8_t  dynamic_keymap_mirror_dirty[(DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_COUNT + 7) / 8];
+static bool     dynamic_keymap_mirror_loaded  = false;
+static bool     dynamic_keymap_mirror_pending = false;
+static uint16_t dynamic_keymap_mirror_timer   = 0;
+
+static inline void dynamic_keymap_mirror_load(void) {
+    if (!dynamic_keymap_mirror_loaded) {
+        eeprom_read_block(dynamic_keymap_mirror, (const void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_EEPROM_SIZE);
+        dynamic_keymap_mirror_loaded = true;
+    }
+}
+
+static void dynamic_keymap_mirror_write(uint32_t offset, uint8_t value) {
+    if (dynamic_keymap_mirror[offset] == value) {
+        return;
+    }
+    dynamic_keymap_mirror[offset] = value;
+
+    uint16_t block = offset / DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_SIZE;
+    dynamic_keymap_mirror_dirty[block / 8] |= 1 << (block % 8);
+    dynamic_keymap_mirror_pending = true;
+    dynamic_keymap_mirror_timer   = timer_read();
+}
+
+void nvm_dynamic_keymap_init(void) {
+    dynamic_keymap_mirror_load();
+}
+
+void nvm_dynamic_keymap_flush(bool force) {
+    if (!dynamic_keymap_mirror_pending) {
+        return;
+    }
+    if (!force && timer_elapsed(dynamic_keymap_mirror_timer) < DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY) {
+        return;
+    }
+
+    for (uint16_t block = 0; block < DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_COUNT; block++) {
+        if (dynamic_keymap_mirror_dirty[block / 8] & (1 << (block % 8))) {
+            uint32_t offset = (uint32_t)block * DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_SIZE;
+            uint32_t size   = DYNAMIC_KEYMAP_EEPROM_SIZE - offset;
+            if (size > DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_SIZE) {
+                size = DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_SIZE;
+            }
+            eeprom_update_block(&dynamic_keymap_mirror[offset], (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), size);
+        }
+    }
+    memset(dynamic_keymap_mirror_dirty, 0, sizeof(dynamic_keymap_mirror_dirty));
+    dynamic_keymap_mirror_pending = false;
+}
+#else
+void nvm_dynamic_keymap_init(void) {}
+
+void nvm_dynamic_keymap_flush(bool force) {}
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void nvm_dynamic_keymap_erase(void) {
     // No-op, nvm_eeconfig_erase() will have already erased EEPROM if necessary.
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    // ...but the mirror may now be stale, so discard it and reload on next access.
+    memset(dynamic_keymap_mirror_dirty, 0, sizeof(dynamic_keymap_mirror_dirty));
+    dynamic_keymap_mirror_pending = false;
+    dynamic_keymap_mirror_loaded  = false;
+#endif
 }
 
 void nvm_dynamic_keymap_macro_erase(void) {
@@ -84,19 +166,32 @@ static inline void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t
 
 uint16_t nvm_dynamic_keymap_read_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_load();
+    const uint8_t *mirror = &dynamic_keymap_mirror[(layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2)];
+    return (mirror[0] << 8) | mirror[1];
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif
 }
 
 void nvm_dynamic_keymap_update_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_load();
+    uint32_t offset = (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+    dynamic_keymap_mirror_write(offset, (uint8_t)(keycode >> 8));
+    dynamic_keymap_mirror_write(offset + 1, (uint8_t)(keycode & 0xFF));
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -123,7 +218,13 @@ void nvm_dynamic_keymap_update_encoder(uint8_t layer, uint8_t encoder_id, bool c
 #endif // ENCODER_MAP_ENABLE
 
 void nvm_dynamic_keymap_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_load();
+    for (uint32_t i = 0; i < size; i++) {
+        data[i] = (offset + i < DYNAMIC_KEYMAP_EEPROM_SIZE) ? dynamic_keymap_mirror[offset + i] : 0x00;
+    }
+#else
+    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_EEPROM_SIZE;
     void *   source                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
     for (uint32_t i = 0; i < size; i++) {
@@ -135,10 +236,17 @@ void nvm_dynamic_keymap_read_buffer(uint32_t offset, uint32_t size, uint8_t *dat
         source++;
         target++;
     }
+#endif
 }
 
 void nvm_dynamic_keymap_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_load();
+    for (uint32_t i = 0; i < size && offset + i < DYNAMIC_KEYMAP_EEPROM_SIZE; i++) {
+        dynamic_keymap_mirror_write(offset + i, data[i]);
+    }
+#else
+    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_EEPROM_SIZE;
     void *   target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
     for (uint32_t i = 0; i < size; i++) {
@@ -148,6 +256,7 @@ void nvm_dynamic_keymap_update_buffer(uint32_t offset, uint32_t size, uint8_t *d
         source++;
         target++;
     }
+#endif
 }
 
 uint32_t nvm_dynamic_keymap_macro_size(void) {
@@ -56,6 +56,15 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of recently-used glyphs whose width and data location are remembered for each font,
+ *      avoiding repeated reads of (and searches through) the font's glyph tables when the same characters are drawn or
+ *      measured. Each entry requires 8 bytes of RAM per font. Disabled by default, 16 is a good size for most fonts.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
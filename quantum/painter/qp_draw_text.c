@@ -12,6 +12,14 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+// Recently-used glyph, holding the raw glyph table value (width and data offset)
+typedef struct qff_glyph_cache_entry_t {
+    uint32_t code_point;
+    uint32_t value;
+} qff_glyph_cache_entry_t;
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
@@ -21,6 +29,7 @@ typedef struct qff_font_handle_t {
     bool                  has_palette;
     bool                  is_panel_native;
     painter_compression_t compression_scheme;
+    uint32_t              glyph_data_offset; // location of the first glyph's data, past the data block header
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
@@ -32,6 +41,11 @@ typedef struct qff_font_handle_t {
     bool  owns_buffer;
     void *buffer;
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Ordered most-recently-used first
+    uint8_t                 glyph_cache_count;
+    qff_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_SIZE];
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
 } qff_font_handle_t;
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
@@ -106,6 +120,18 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+    // Work out where the glyph data starts, so that it doesn't need to be recalculated for every glyph
+    font->glyph_data_offset = sizeof(qff_font_descriptor_v1_t)                                                                                                             // Skip the font descriptor
+                              + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                           // Skip the ascii table
+                              + (font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                              + (font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                 // Skip the palette
+                              + sizeof(qgf_block_header_v1_t);                                                                                                             // Skip the data block header
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Forget anything cached from a font previously loaded into this slot
+    font->glyph_cache_count = 0;
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -161,7 +187,7 @@ bool qp_close_font(painter_font_handle_t font) {
 // Helpers
 
 // Callback to be invoked for each codepoint detected in the UTF8 input string
-typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
+typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, uint32_t data_offset, void *cb_arg);
 
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
@@ -214,7 +240,11 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
-static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+// Number of unicode glyph table entries read at a time while searching for a code point
+#define QFF_UNICODE_GLYPH_READ_BATCH 8
+
+// Helper that reads the raw glyph table value (width and data offset) for the supplied code point
+static bool qp_drawtext_read_glyph_info(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t *value) {
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
@@ -231,21 +261,7 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
+        *value = glyph_info.value;
         return true;
     } else {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
@@ -258,30 +274,20 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
-            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+        // Read the table a batch of glyphs at a time, rather than issuing a stream read per glyph
+        qff_unicode_glyph_v1_t glyph_info[QFF_UNICODE_GLYPH_READ_BATCH];
+        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; i += QFF_UNICODE_GLYPH_READ_BATCH) {
+            uint16_t count = QP_MIN(QFF_UNICODE_GLYPH_READ_BATCH, qff_font->num_unicode_glyphs - i);
+            if (qp_stream_read(glyph_info, sizeof(qff_unicode_glyph_v1_t), count, &qff_font->stream) != count) {
                 qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
                 return false;
             }
 
-            if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
+            for (uint16_t j = 0; j < count; ++j) {
+                if (glyph_info[j].code_point == code_point) {
+                    *value = glyph_info[j].value;
+                    return true;
                 }
-
-                *width = glyph_width;
-                return true;
             }
         }
 
@@ -292,6 +298,52 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
     return false;
 }
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+// Helper that looks up a glyph in the font's cache, moving it to the front if found
+static inline bool qp_drawtext_glyph_cache_find(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t *value) {
+    for (uint8_t i = 0; i < qff_font->glyph_cache_count; ++i) {
+        if (qff_font->glyph_cache[i].code_point == code_point) {
+            qff_glyph_cache_entry_t entry = qff_font->glyph_cache[i];
+            memmove(&qff_font->glyph_cache[1], &qff_font->glyph_cache[0], i * sizeof(qff_glyph_cache_entry_t));
+            qff_font->glyph_cache[0] = entry;
+            *value                   = entry.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Helper that adds a glyph to the front of the font's cache, evicting the least-recently-used glyph if full
+static inline void qp_drawtext_glyph_cache_insert(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t value) {
+    if (qff_font->glyph_cache_count < QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+        ++qff_font->glyph_cache_count;
+    }
+    memmove(&qff_font->glyph_cache[1], &qff_font->glyph_cache[0], (qff_font->glyph_cache_count - 1) * sizeof(qff_glyph_cache_entry_t));
+    qff_font->glyph_cache[0] = (qff_glyph_cache_entry_t){.code_point = code_point, .value = value};
+}
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+// Helper that determines the width of a glyph, and the offset in the stream that its data starts
+static inline bool qp_drawtext_lookup_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width, uint32_t *data_offset) {
+    uint32_t value;
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    if (!qp_drawtext_glyph_cache_find(qff_font, code_point, &value)) {
+        if (!qp_drawtext_read_glyph_info(qff_font, code_point, &value)) {
+            return false;
+        }
+        qp_drawtext_glyph_cache_insert(qff_font, code_point, value);
+    }
+#else  // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    if (!qp_drawtext_read_glyph_info(qff_font, code_point, &value)) {
+        return false;
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+    *width       = (uint8_t)(value & QFF_GLYPH_WIDTH_MASK);
+    *data_offset = qff_font->glyph_data_offset + ((value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+    return true;
+}
+
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
 static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_handler handler, void *cb_arg) {
     while (*str) {
@@ -302,13 +354,14 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
             return false;
         }
 
-        uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        uint8_t  width;
+        uint32_t data_offset;
+        if (!qp_drawtext_lookup_glyph(qff_font, code_point, &width, &data_offset)) {
             qp_dprintf("Failed to prepare glyph for rendering.\n");
             return false;
         }
 
-        if (!handler(qff_font, code_point, width, qff_font->base.line_height, cb_arg)) {
+        if (!handler(qff_font, code_point, width, qff_font->base.line_height, data_offset, cb_arg)) {
             qp_dprintf("Failed to execute glyph handler.\n");
             return false;
         }
@@ -325,7 +378,7 @@ typedef struct code_point_iter_calcwidth_state_t {
 } code_point_iter_calcwidth_state_t;
 
 // Codepoint handler callback: width calc
-static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, uint32_t data_offset, void *cb_arg) {
     code_point_iter_calcwidth_state_t *state = (code_point_iter_calcwidth_state_t *)cb_arg;
 
     // Increment the overall width by this glyph's width
@@ -348,11 +401,17 @@ typedef struct code_point_iter_drawglyph_state_t {
 } code_point_iter_drawglyph_state_t;
 
 // Codepoint handler callback: drawing
-static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, uint32_t data_offset, void *cb_arg) {
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
     painter_driver_t *                 driver = (painter_driver_t *)state->device;
 
-    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
+    // Move to the start of the glyph's data
+    if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+
+    // Reset the input state's RLE mode
     state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
 
     // Reset the output state
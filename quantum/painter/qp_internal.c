@@ -5,6 +5,10 @@
 
 #include "compiler_support.h"
 
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+#    include "qp_surface_internal.h"
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Core API: device registration
 
@@ -25,7 +29,7 @@ enum {
                      + (LD7032_NUM_DEVICES)  // LD7032
 };
 
-static painter_device_t qp_devices[QP_NUM_DEVICES] = {NULL};
+static painter_device_t qp_devices[QP_NUM_DEVICES];
 
 bool qp_internal_register_device(painter_device_t driver) {
     for (uint8_t i = 0; i < QP_NUM_DEVICES; i++) {
@@ -72,6 +76,11 @@ static void qp_internal_display_timeout_task(void) {
 STATIC_ASSERT((QUANTUM_PAINTER_TASK_THROTTLE) > 0 && (QUANTUM_PAINTER_TASK_THROTTLE) < 1000, "QUANTUM_PAINTER_TASK_THROTTLE must be between 1 and 999");
 
 void qp_internal_task(void) {
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+    // Send the next part of any asynchronous surface draws -- not throttled, so that each pass of the main loop moves them along
+    qp_surface_internal_async_task();
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
+
     // Perform throttling of the internal processing of Quantum Painter
     static uint32_t last_tick = 0;
     uint32_t        now       = timer_read32();
@@ -26,6 +26,9 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#ifdef COMBO_KEYCODE_INDEX
+#    include "debug.h"
+#endif
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -256,6 +259,7 @@ static inline void dump_key_buffer(void) {
         // only delay once and for a non-tapping key
         if (!delay_done && !is_tap_record(record)) {
             delay_done = true;
+            flush_keyboard_report();
             wait_ms(TAP_CODE_DELAY);
         }
 #endif
@@ -286,6 +290,180 @@ static inline void _find_key_index_and_count(const uint16_t *keys, uint16_t keyc
     }
 }
 
+#ifdef COMBO_KEYCODE_INDEX
+/* Keycode -> combo lookup table.
+ *
+ * The index stores every distinct keycode used by the combos in ascending
+ * order, together with an offset into a flat list of combo indices. The combos
+ * of each keycode are kept in ascending order, so the combos are visited in the
+ * same order as the full scan would. The index is built lazily on the first key
+ * event and whenever it is invalidated. If the combos don't fit into the
+ * configured table sizes, processing falls back to scanning all combos. */
+static bool     combo_index_valid         = false;
+static bool     combo_index_overflow      = false;
+static uint16_t combo_index_keycode_count = 0;
+static uint16_t combo_index_keycodes[COMBO_KEYCODE_INDEX_MAX_KEYCODES];
+static uint16_t combo_index_offsets[COMBO_KEYCODE_INDEX_MAX_KEYCODES + 1];
+static uint16_t combo_index_combos[COMBO_KEYCODE_INDEX_LENGTH];
+
+/* Combos whose keycodes are all among the first 32 (or 64) keycodes of the
+ * index are compared with a key mask when resolving overlaps. The masks of the
+ * first COMBO_KEYCODE_INDEX_MAX_COMBOS combos are built with the index, a key
+ * count of 0 marks a combo which has to be compared key by key. */
+#    if COMBO_KEYCODE_INDEX_MAX_KEYCODES <= 32
+typedef uint32_t combo_key_mask_t;
+#    else
+typedef uint64_t combo_key_mask_t;
+#    endif
+
+static combo_key_mask_t combo_index_masks[COMBO_KEYCODE_INDEX_MAX_COMBOS];
+static uint8_t          combo_index_key_counts[COMBO_KEYCODE_INDEX_MAX_COMBOS];
+
+void combo_index_invalidate(void) {
+    combo_index_valid = false;
+}
+
+static uint16_t combo_index_find(uint16_t keycode) {
+    /* Binary search, returns the position the keycode is or would be at. */
+    uint16_t low = 0, high = combo_index_keycode_count;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_index_keycodes[mid] < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static inline bool combo_key_is_repeated(const uint16_t *keys, uint8_t key_index, uint16_t keycode) {
+    for (uint8_t i = 0; i < key_index; i++) {
+        if (pgm_read_word(&keys[i]) == keycode) return true;
+    }
+    return false;
+}
+
+static bool combo_key_mask(const combo_t *combo, combo_key_mask_t *mask, uint8_t *key_count) {
+    /* Sets bit n of the mask for the n-th keycode of the index, and counts the
+     * keys as they are listed in the combo. Returns false if a keycode is past
+     * the width of the mask. */
+    uint16_t key;
+    *mask      = 0;
+    *key_count = 0;
+    while ((key = pgm_read_word(&combo->keys[*key_count])) != COMBO_END) {
+        uint16_t pos = combo_index_find(key);
+        if (pos >= sizeof(combo_key_mask_t) * 8 || pos >= combo_index_keycode_count || combo_index_keycodes[pos] != key) {
+            return false;
+        }
+        *mask |= (combo_key_mask_t)1 << pos;
+        (*key_count)++;
+    }
+    return true;
+}
+
+static void combo_index_build(void) {
+    uint16_t total = 0;
+
+    combo_index_valid         = true;
+    combo_index_overflow      = true;
+    combo_index_keycode_count = 0;
+
+    /* Collect the distinct keycodes and count the combos using each of them. */
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+        for (uint8_t key_index = 0; (key = pgm_read_word(&keys[key_index])) != COMBO_END; key_index++) {
+            if (combo_key_is_repeated(keys, key_index, key)) continue;
+
+            uint16_t pos = combo_index_find(key);
+            if (pos == combo_index_keycode_count || combo_index_keycodes[pos] != key) {
+                if (combo_index_keycode_count == COMBO_KEYCODE_INDEX_MAX_KEYCODES) {
+                    dprintf("combo: more than %u keycodes, increase COMBO_KEYCODE_INDEX_MAX_KEYCODES\n", COMBO_KEYCODE_INDEX_MAX_KEYCODES);
+                    return;
+                }
+                for (uint16_t i = combo_index_keycode_count; i > pos; i--) {
+                    combo_index_keycodes[i] = combo_index_keycodes[i - 1];
+                    combo_index_offsets[i]  = combo_index_offsets[i - 1];
+                }
+                combo_index_keycodes[pos] = key;
+                combo_index_offsets[pos]  = 0;
+                combo_index_keycode_count++;
+            }
+            combo_index_offsets[pos]++;
+            if (++total > COMBO_KEYCODE_INDEX_LENGTH) {
+                dprintf("combo: more than %u combo keys, increase COMBO_KEYCODE_INDEX_LENGTH\n", COMBO_KEYCODE_INDEX_LENGTH);
+                return;
+            }
+        }
+    }
+
+    /* Turn the counts into start offsets... */
+    total = 0;
+    for (uint16_t i = 0; i < combo_index_keycode_count; i++) {
+        uint16_t count         = combo_index_offsets[i];
+        combo_index_offsets[i] = total;
+        total += count;
+    }
+    combo_index_offsets[combo_index_keycode_count] = total;
+
+    /* ...fill in the combos, using the start offsets as write cursors... */
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+        for (uint8_t key_index = 0; (key = pgm_read_word(&keys[key_index])) != COMBO_END; key_index++) {
+            if (combo_key_is_repeated(keys, key_index, key)) continue;
+
+            uint16_t pos                                  = combo_index_find(key);
+            combo_index_combos[combo_index_offsets[pos]++] = idx;
+        }
+    }
+
+    /* ...which leaves each cursor at the start of the next keycode. */
+    for (uint16_t i = combo_index_keycode_count; i > 0; i--) {
+        combo_index_offsets[i] = combo_index_offsets[i - 1];
+    }
+    combo_index_offsets[0] = 0;
+
+    /* Precompute the key masks used to resolve overlaps. */
+    for (uint16_t idx = 0; idx < combo_count() && idx < COMBO_KEYCODE_INDEX_MAX_COMBOS; ++idx) {
+        if (!combo_key_mask(combo_get(idx), &combo_index_masks[idx], &combo_index_key_counts[idx])) {
+            combo_index_key_counts[idx] = 0;
+        }
+    }
+
+    combo_index_overflow = false;
+}
+
+static bool combo_index_ready(void) {
+    /* Returns false if the index can't be used and all combos have to be scanned. */
+    if (!combo_index_valid) {
+        combo_index_build();
+    }
+    return !combo_index_overflow;
+}
+
+bool combo_index_overflowed(void) {
+    /* Lets keymaps and tests check that the combos fit, the console is rarely enabled. */
+    return !combo_index_ready();
+}
+
+static bool combo_index_lookup(uint16_t keycode, uint16_t *first, uint16_t *last) {
+    if (!combo_index_ready()) {
+        return false;
+    }
+
+    uint16_t pos = combo_index_find(keycode);
+    if (pos < combo_index_keycode_count && combo_index_keycodes[pos] == keycode) {
+        *first = combo_index_offsets[pos];
+        *last  = combo_index_offsets[pos + 1];
+    } else {
+        *first = *last = 0;
+    }
+    return true;
+}
+#endif
+
 void drop_combo_from_buffer(uint16_t combo_index) {
     /* Mark a combo as processed from the buffer. If the buffer is in the
      * beginning of the buffer, drop it.  */
@@ -322,6 +500,11 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
 #else
     uint8_t state = 0;
 #endif
+#ifdef KEY_LATENCY_ENABLE
+    // the combo's latency is measured from its first key, which is the oldest in the buffer
+    bool     edge_found = false;
+    uint16_t edge_time  = 0;
+#endif
 
     for (uint8_t key_buffer_i = 0; key_buffer_i < key_buffer_size; key_buffer_i++) {
         queued_record_t *qrecord = &key_buffer[key_buffer_i];
@@ -337,12 +520,22 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
             continue;
         }
 
+#ifdef KEY_LATENCY_ENABLE
+        if (!edge_found) {
+            edge_found = true;
+            edge_time  = record->event.edge_time;
+        }
+#endif
+
         KEY_STATE_DOWN(state, key_index);
         if (ALL_COMBO_KEYS_ARE_DOWN(state, key_count)) {
             // this in the end executes the combo when the key_buffer is dumped.
             record->keycode    = combo->keycode;
             record->event.type = COMBO_EVENT;
             record->event.key  = MAKE_KEYPOS(0, 0);
+#ifdef KEY_LATENCY_ENABLE
+            record->event.edge_time = edge_time;
+#endif
 
             qrecord->combo_index = combo_index;
             ACTIVATE_COMBO(combo);
@@ -376,11 +569,25 @@ static inline void apply_combos(void) {
     clear_combos();
 }
 
-combo_t *overlaps(combo_t *combo1, combo_t *combo2) {
+combo_t *overlaps(uint16_t combo_index1, uint16_t combo_index2) {
     /* Checks if the combos overlap and returns the combo that should be
      * dropped from the combo buffer.
      * The combo that has less keys will be dropped. If they have the same
      * amount of keys, drop combo1. */
+    combo_t *combo1 = combo_get(combo_index1);
+    combo_t *combo2 = combo_get(combo_index2);
+
+#ifdef COMBO_KEYCODE_INDEX
+    if (combo_index_ready() && combo_index1 < COMBO_KEYCODE_INDEX_MAX_COMBOS && combo_index2 < COMBO_KEYCODE_INDEX_MAX_COMBOS) {
+        uint8_t count1 = combo_index_key_counts[combo_index1];
+        uint8_t count2 = combo_index_key_counts[combo_index2];
+        if (count1 && count2) {
+            if (!(combo_index_masks[combo_index1] & combo_index_masks[combo_index2])) return NULL;
+            if (count2 < count1) return combo2;
+            return combo1;
+        }
+    }
+#endif
 
     uint8_t  idx1 = 0, idx2 = 0;
     uint16_t key1, key2;
@@ -468,7 +675,7 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
                     queued_combo_t *qcombo         = &combo_buffer[combo_buffer_i];
                     combo_t *       buffered_combo = combo_get(qcombo->combo_index);
 
-                    if ((drop = overlaps(buffered_combo, combo))) {
+                    if ((drop = overlaps(qcombo->combo_index, combo_index))) {
                         DISABLE_COMBO(drop);
                         if (drop == combo) {
                             // stop checking for overlaps if dropped combo was current combo.
@@ -581,10 +788,24 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEYCODE_INDEX
+    uint16_t first, last;
+    if (combo_index_lookup(keycode, &first, &last)) {
+        /* Only visit the combos containing this keycode. */
+        for (uint16_t i = first; i < last; ++i) {
+            uint16_t idx   = combo_index_combos[i];
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -39,6 +39,18 @@
 #    define COMBO_BUFFER_LENGTH 4
 #endif
 
+#ifdef COMBO_KEYCODE_INDEX
+#    ifndef COMBO_KEYCODE_INDEX_MAX_KEYCODES
+#        define COMBO_KEYCODE_INDEX_MAX_KEYCODES 64
+#    endif
+#    ifndef COMBO_KEYCODE_INDEX_LENGTH
+#        define COMBO_KEYCODE_INDEX_LENGTH 256
+#    endif
+#    ifndef COMBO_KEYCODE_INDEX_MAX_COMBOS
+#        define COMBO_KEYCODE_INDEX_MAX_COMBOS 128
+#    endif
+#endif
+
 typedef struct combo_t {
     const uint16_t *keys;
     uint16_t        keycode;
@@ -81,3 +93,8 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_KEYCODE_INDEX
+void combo_index_invalidate(void);
+bool combo_index_overflowed(void);
+#endif
@@ -243,13 +243,137 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX
+/* Trigger keycode -> key override lookup table.
+ *
+ * Holds every key override index, sorted by trigger keycode and then by index, so the overrides sharing a trigger
+ * are visited in the same order as the full scan would. The table is built lazily on the first key event and whenever
+ * it is invalidated. If there are more key overrides than the configured table size, processing falls back to
+ * scanning all key overrides. */
+static bool     ko_index_valid    = false;
+static bool     ko_index_overflow = false;
+static uint16_t ko_index_count    = 0;
+static uint16_t ko_index_triggers[KEY_OVERRIDE_TRIGGER_INDEX_LENGTH];
+static uint16_t ko_index_overrides[KEY_OVERRIDE_TRIGGER_INDEX_LENGTH];
+
+#    define KO_INDEX_END UINT16_MAX
+
+// Overrides using each of the triggers which can activate on a key event: the event keycode, the last key pressed down, and KC_NO
+typedef struct key_override_candidates_t {
+    uint16_t pos[3];
+    uint16_t end[3];
+} key_override_candidates_t;
+
+void key_override_index_invalidate(void) {
+    ko_index_valid = false;
+}
+
+/* Binary search, returns the position of the first entry with a trigger not less than the one supplied. */
+static uint16_t key_override_index_find(uint16_t trigger) {
+    uint16_t low = 0, high = ko_index_count;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (ko_index_triggers[mid] < trigger) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static void key_override_index_build(void) {
+    ko_index_valid    = true;
+    ko_index_overflow = true;
+    ko_index_count    = 0;
+
+    for (uint16_t idx = 0; idx < key_override_count(); ++idx) {
+        const key_override_t *const override = key_override_get(idx);
+        if (override == NULL) {
+            break;
+        }
+        if (ko_index_count == KEY_OVERRIDE_TRIGGER_INDEX_LENGTH) {
+            return;
+        }
+
+        // Insert after any overrides with the same trigger, keeping them in index order
+        uint16_t pos = key_override_index_find(override->trigger + 1);
+        if (override->trigger == UINT16_MAX) {
+            pos = ko_index_count;
+        }
+        for (uint16_t i = ko_index_count; i > pos; i--) {
+            ko_index_triggers[i]  = ko_index_triggers[i - 1];
+            ko_index_overrides[i] = ko_index_overrides[i - 1];
+        }
+        ko_index_triggers[pos]  = override->trigger;
+        ko_index_overrides[pos] = idx;
+        ko_index_count++;
+    }
+
+    ko_index_overflow = false;
+}
+
+/* Returns false if the index can't be used and all key overrides have to be scanned. */
+static bool key_override_index_lookup(uint16_t keycode, key_override_candidates_t *candidates) {
+    if (!ko_index_valid) {
+        key_override_index_build();
+    }
+    if (ko_index_overflow) {
+        return false;
+    }
+
+    const uint16_t triggers[3] = {keycode, last_key_down, KC_NO};
+    for (uint8_t t = 0; t < 3; t++) {
+        bool repeated = (t > 0 && triggers[t] == triggers[0]) || (t > 1 && triggers[t] == triggers[1]);
+        if (repeated) {
+            candidates->pos[t] = candidates->end[t] = 0;
+            continue;
+        }
+        uint16_t pos       = key_override_index_find(triggers[t]);
+        candidates->pos[t] = pos;
+        while (pos < ko_index_count && ko_index_triggers[pos] == triggers[t]) {
+            pos++;
+        }
+        candidates->end[t] = pos;
+    }
+    return true;
+}
+
+/* Returns the lowest remaining key override index across the candidate triggers, or KO_INDEX_END. */
+static uint16_t key_override_index_next(key_override_candidates_t *candidates) {
+    uint8_t  best     = 0;
+    uint16_t best_idx = KO_INDEX_END;
+    for (uint8_t t = 0; t < 3; t++) {
+        if (candidates->pos[t] < candidates->end[t] && ko_index_overrides[candidates->pos[t]] < best_idx) {
+            best     = t;
+            best_idx = ko_index_overrides[candidates->pos[t]];
+        }
+    }
+    if (best_idx != KO_INDEX_END) {
+        candidates->pos[best]++;
+    }
+    return best_idx;
+}
+#endif
+
 /** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
 static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
     if (key_override_count() == 0) {
         return true;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX
+    key_override_candidates_t candidates;
+    const bool                use_index = key_override_index_lookup(keycode, &candidates);
+#endif
+
+    for (uint16_t i = 0; i < key_override_count(); i++) {
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX
+        // Skip straight to the next override whose trigger can activate on this event
+        if (use_index && (i = key_override_index_next(&candidates)) == KO_INDEX_END) {
+            break;
+        }
+#endif
         const key_override_t *const override = key_override_get(i);
 
         // End of array
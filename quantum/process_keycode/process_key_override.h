@@ -105,6 +105,15 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
 /** Perform any deferred keys */
 void key_override_task(void);
 
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX
+#    ifndef KEY_OVERRIDE_TRIGGER_INDEX_LENGTH
+#        define KEY_OVERRIDE_TRIGGER_INDEX_LENGTH 256
+#    endif
+
+/** Rebuilds the trigger index before the next key event. Call this after changing key overrides at runtime. */
+void key_override_index_invalidate(void);
+#endif
+
 /**
  *  Preferrably use these macros to create key overrides. They fix many of the options to a standard setting that should satisfy most basic use-cases. Only directly create a key_override_t struct when you really need to.
  */
@@ -84,6 +84,10 @@
 #    include "process_layer_lock.h"
 #endif
 
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_WRITE_BACK)
+#    include "wear_leveling.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -148,6 +152,7 @@ __attribute__((weak)) void unregister_code16(uint16_t code) {
  */
 __attribute__((weak)) void tap_code16_delay(uint16_t code, uint16_t delay) {
     register_code16(code);
+    flush_keyboard_report();
     for (uint16_t i = delay; i > 0; i--) {
         wait_ms(1);
     }
@@ -208,6 +213,14 @@ __attribute__((weak)) void suspend_wakeup_init_modules(void) {}
 
 void shutdown_quantum(bool jump_to_bootloader) {
     clear_keyboard();
+    // Make sure the host sees everything released before the keyboard goes away
+    flush_keyboard_report();
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_MIRROR)
+    dynamic_keymap_flush();
+#endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_WRITE_BACK)
+    wear_leveling_sync();
+#endif
 #if defined(MIDI_ENABLE) && defined(MIDI_BASIC)
     process_midi_all_notes_off();
 #endif
@@ -270,10 +283,10 @@ uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache) {
         } else {
             layer = read_source_layers_cache(event.key);
         }
-        return keymap_key_to_keycode(layer, event.key);
+        return resolved_keymap_cache_keycode(layer, event.key);
     } else
 #endif
-        return keymap_key_to_keycode(layer_switch_get_layer(event.key), event.key);
+        return resolved_keymap_cache_keycode(layer_switch_get_layer(event.key), event.key);
 }
 
 /* Get keycode, and then process pre tapping functionality */
@@ -548,6 +561,12 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 }
 
 void suspend_power_down_quantum(void) {
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_MIRROR)
+    dynamic_keymap_flush();
+#endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_WRITE_BACK)
+    wear_leveling_sync();
+#endif
     suspend_power_down_modules();
     suspend_power_down_kb();
 #ifndef NO_SUSPEND_POWER_DOWN
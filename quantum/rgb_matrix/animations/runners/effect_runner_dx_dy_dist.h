@@ -10,9 +10,13 @@ bool effect_runner_dx_dy_dist(effect_params_t* params, dx_dy_dist_f effect_func)
         RGB_MATRIX_TEST_LED_FLAGS();
         int16_t dx   = g_led_config.point[i].x - k_rgb_matrix_center.x;
         int16_t dy   = g_led_config.point[i].y - k_rgb_matrix_center.y;
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+        uint8_t dist = g_rgb_matrix_geometry[i].dist;
+#else
         uint8_t dist = sqrt16(dx * dx + dy * dy);
-        rgb_t   rgb  = rgb_matrix_hsv_to_rgb(effect_func(rgb_matrix_config.hsv, dx, dy, dist, time));
-        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+#endif
+        rgb_matrix_render_hsv(i, effect_func(rgb_matrix_config.hsv, dx, dy, dist, time));
     }
+    rgb_matrix_flush_hsv();
     return rgb_matrix_check_finished_leds(led_max);
 }
@@ -38,6 +38,40 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+#ifdef RGB_MATRIX_HSV_BATCH_SIZE
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_buffer(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    hsv_to_rgb_buffer(hsv, rgb, count);
+}
+
+static uint8_t hsv_batch_index[RGB_MATRIX_HSV_BATCH_SIZE];
+static hsv_t   hsv_batch[RGB_MATRIX_HSV_BATCH_SIZE];
+static uint8_t hsv_batch_count = 0;
+
+static void rgb_matrix_flush_hsv(void) {
+    rgb_t rgb[RGB_MATRIX_HSV_BATCH_SIZE];
+    rgb_matrix_hsv_to_rgb_buffer(hsv_batch, rgb, hsv_batch_count);
+    for (uint8_t i = 0; i < hsv_batch_count; i++) {
+        rgb_matrix_set_color(hsv_batch_index[i], rgb[i].r, rgb[i].g, rgb[i].b);
+    }
+    hsv_batch_count = 0;
+}
+
+static void rgb_matrix_render_hsv(uint8_t index, hsv_t hsv) {
+    hsv_batch_index[hsv_batch_count] = index;
+    hsv_batch[hsv_batch_count]       = hsv;
+    if (++hsv_batch_count == RGB_MATRIX_HSV_BATCH_SIZE) {
+        rgb_matrix_flush_hsv();
+    }
+}
+#else
+static inline void rgb_matrix_flush_hsv(void) {}
+
+static inline void rgb_matrix_render_hsv(uint8_t index, hsv_t hsv) {
+    rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
+    rgb_matrix_set_color(index, rgb.r, rgb.g, rgb.b);
+}
+#endif // RGB_MATRIX_HSV_BATCH_SIZE
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -71,6 +105,9 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+led_geometry_t g_rgb_matrix_geometry[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_GEOMETRY_CACHE
 
 // internals
 static bool            suspend_state     = false;
@@ -473,9 +510,24 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+void rgb_matrix_update_geometry(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx                     = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy                     = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        g_rgb_matrix_geometry[i].dist  = sqrt16(dx * dx + dy * dy);
+        g_rgb_matrix_geometry[i].angle = atan2_8(dy, dx);
+    }
+}
+#endif // RGB_MATRIX_GEOMETRY_CACHE
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    rgb_matrix_update_geometry();
+#endif // RGB_MATRIX_GEOMETRY_CACHE
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
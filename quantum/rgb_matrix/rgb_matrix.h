@@ -286,3 +286,8 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+extern led_geometry_t g_rgb_matrix_geometry[RGB_MATRIX_LED_COUNT];
+
+void rgb_matrix_update_geometry(void);
+#endif
@@ -57,6 +57,13 @@ typedef struct PACKED {
     uint8_t y;
 } led_point_t;
 
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+typedef struct PACKED {
+    uint8_t dist;
+    uint8_t angle;
+} led_geometry_t;
+#endif // RGB_MATRIX_GEOMETRY_CACHE
+
 #define HAS_FLAGS(bits, flags) ((bits & flags) == flags)
 #define HAS_ANY_FLAGS(bits, flags) ((bits & flags) != 0x00)
 
@@ -26,6 +26,16 @@ enum serial_transaction_id {
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
+#ifdef SPLIT_MATRIX_DELTA
+    GET_SLAVE_MATRIX_SEQUENCE,
+    GET_SLAVE_MATRIX_RECENT_EVENTS,
+    GET_SLAVE_MATRIX_EVENTS,
+#endif // SPLIT_MATRIX_DELTA
+
+#ifdef SPLIT_TRANSACTION_PACKED
+    PUT_PACKED,
+#endif // SPLIT_TRANSACTION_PACKED
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -159,10 +159,33 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
     return okay;
 }
 
+#ifdef SPLIT_TRANSACTION_PACKED
+
+static uint32_t packed_pending = 0; // sections waiting for the next packed frame
+
+// Queues the data for the next packed frame, unless the transaction can't be packed
+static bool transport_stage(int8_t id, const void *source, size_t length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (trans->slave_callback || length != trans->initiator2target_buffer_size || length > SPLIT_TRANSACTION_PACKED_SIZE) {
+        return transport_write(id, source, length);
+    }
+    if (source != split_trans_initiator2target_buffer(trans)) {
+        memcpy(split_trans_initiator2target_buffer(trans), source, length);
+    }
+    packed_pending |= (uint32_t)1 << id;
+    return true;
+}
+
+#else // SPLIT_TRANSACTION_PACKED
+
+#    define transport_stage(id, data, length) transport_write(id, data, length)
+
+#endif // SPLIT_TRANSACTION_PACKED
+
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
     if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
+        okay &= transport_stage(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
         }
@@ -178,34 +201,320 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+static matrix_row_t last_slave_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
+
+#ifdef SPLIT_MATRIX_DELTA
+
+STATIC_ASSERT((MATRIX_ROWS) / 2 < SPLIT_MATRIX_EVENT_PRESSED, "Too many rows per half for the matrix event format");
+STATIC_ASSERT(sizeof(split_slave_events_sync_t) <= UINT8_MAX, "SPLIT_MATRIX_EVENT_COUNT too large");
+STATIC_ASSERT(SPLIT_MATRIX_EVENT_RECENT > 0 && SPLIT_MATRIX_EVENT_RECENT <= SPLIT_MATRIX_EVENT_COUNT, "SPLIT_MATRIX_EVENT_RECENT must be between 1 and SPLIT_MATRIX_EVENT_COUNT");
+
+// The leading part of the queue read when the master is at most SPLIT_MATRIX_EVENT_RECENT events behind
+#    define SLAVE_RECENT_EVENTS_SIZE (offsetof(split_slave_events_sync_t, events) + SPLIT_MATRIX_EVENT_RECENT * sizeof(split_matrix_event_t))
+
+static uint8_t  last_slave_sequence = 0; // sequence number of the last event applied to last_slave_matrix
+static uint16_t slave_edge_time[(MATRIX_ROWS) / 2];
+
+static uint8_t slave_events_checksum(const split_slave_events_sync_t *queue, uint8_t count) {
+    return crc8(&queue->sequence, offsetof(split_slave_events_sync_t, events) - offsetof(split_slave_events_sync_t, sequence) + count * sizeof(split_matrix_event_t));
+}
+
+// Reads the whole matrix, for when the event queue no longer holds every change since the last one applied
+static bool slave_matrix_resync(uint8_t sequence) {
+    matrix_row_t temp_matrix[(MATRIX_ROWS) / 2];
+    uint8_t      checksum;
+
+    bool okay = transport_read(GET_SLAVE_MATRIX_CHECKSUM, &checksum, sizeof(checksum));
+    okay      = okay && transport_read(GET_SLAVE_MATRIX_DATA, temp_matrix, sizeof(temp_matrix));
+    okay      = okay && checksum == crc8(temp_matrix, sizeof(temp_matrix));
+    if (okay) {
+        for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+            if (temp_matrix[row] != last_slave_matrix[row]) {
+                slave_edge_time[row] = timer_read();
+            }
+        }
+        memcpy(last_slave_matrix, temp_matrix, sizeof(temp_matrix));
+        // The matrix is at least as new as the sequence number, and replaying an event that is already reflected in it is harmless
+        last_slave_sequence = sequence;
+    }
+    return okay;
+}
+
+// Applies queued events in order. The master processes a matrix change in row and column order, so this
+// stops at the first event that would be processed ahead of an earlier one, leaving it for the next scan.
+static void slave_matrix_apply_events(const split_slave_events_sync_t *queue) {
+    matrix_row_t changed[(MATRIX_ROWS) / 2] = {0};
+    uint16_t     last_position              = 0;
+
+    while (last_slave_sequence != queue->sequence) {
+        const split_matrix_event_t *event    = &queue->events[(uint8_t)(queue->sequence - (uint8_t)(last_slave_sequence + 1))];
+        const uint8_t               row      = event->row & ~SPLIT_MATRIX_EVENT_PRESSED;
+        const uint16_t              position = row * MATRIX_COLS + event->col + 1;
+        if (row >= (MATRIX_ROWS) / 2 || position <= last_position) {
+            break;
+        }
+
+        if (!changed[row]) {
+            slave_edge_time[row] = event->time;
+        }
+        changed[row] |= (matrix_row_t)1 << event->col;
+        if (event->row & SPLIT_MATRIX_EVENT_PRESSED) {
+            last_slave_matrix[row] |= (matrix_row_t)1 << event->col;
+        } else {
+            last_slave_matrix[row] &= ~((matrix_row_t)1 << event->col);
+        }
+        last_position = position;
+        last_slave_sequence++;
+    }
+}
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t     last_update                    = 0;
-    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
-    matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
+    static uint32_t           last_update = 0;
+    split_slave_events_sync_t queue;
+    uint8_t                   sequence;
+
+    bool okay = transport_read(GET_SLAVE_MATRIX_SEQUENCE, &sequence, sizeof(sequence));
+    if (okay && sequence != last_slave_sequence) {
+        // Only the unread events are needed, which are usually among the few newest ones
+        bool recent = (uint8_t)(sequence - last_slave_sequence) <= SPLIT_MATRIX_EVENT_RECENT;
+        if (recent) {
+            okay = transport_read(GET_SLAVE_MATRIX_RECENT_EVENTS, &queue, SLAVE_RECENT_EVENTS_SIZE);
+            okay = okay && queue.recent_checksum == slave_events_checksum(&queue, SPLIT_MATRIX_EVENT_RECENT);
+            // The slave may have queued more events since the sequence number was read
+            recent = !okay || (uint8_t)(queue.sequence - last_slave_sequence) <= SPLIT_MATRIX_EVENT_RECENT;
+        }
+        if (!recent) {
+            okay = transport_read(GET_SLAVE_MATRIX_EVENTS, &queue, sizeof(queue));
+            okay = okay && queue.checksum == slave_events_checksum(&queue, SPLIT_MATRIX_EVENT_COUNT);
+        }
+        if (okay && (uint8_t)(queue.sequence - last_slave_sequence) > SPLIT_MATRIX_EVENT_COUNT) {
+            // Older events have been overwritten before they were read
+            okay = slave_matrix_resync(queue.sequence);
+        } else if (okay) {
+            slave_matrix_apply_events(&queue);
+        }
+    } else if (okay && timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
+        okay = slave_matrix_resync(sequence);
+        if (okay) {
+            last_update = timer_read32();
+        }
+    }
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, last_slave_matrix, sizeof(last_slave_matrix));
+    return okay;
+}
+
+// Queues an event for each key that changed since the matrix was last published
+static void slave_matrix_queue_events(matrix_row_t slave_matrix[]) {
+    split_slave_events_sync_t *queue  = &split_shmem->sevents;
+    const uint16_t             now    = sync_timer_read();
+    bool                       queued = false;
+
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+        matrix_row_t changes = slave_matrix[row] ^ split_shmem->smatrix.matrix[row];
+        for (uint8_t col = 0; changes; col++, changes >>= 1) {
+            if (changes & 1) {
+                // Keep the newest event first, so the master can read just the start of the queue
+                memmove(&queue->events[1], &queue->events[0], sizeof(queue->events) - sizeof(queue->events[0]));
+                split_matrix_event_t *event = &queue->events[0];
+                event->row                  = row | ((slave_matrix[row] >> col) & 1 ? SPLIT_MATRIX_EVENT_PRESSED : 0);
+                event->col                  = col;
+                event->time                 = now;
+                queue->sequence++;
+                queued = true;
+            }
+        }
+    }
+    if (queued) {
+        queue->recent_checksum = slave_events_checksum(queue, SPLIT_MATRIX_EVENT_RECENT);
+        queue->checksum        = slave_events_checksum(queue, SPLIT_MATRIX_EVENT_COUNT);
+    }
+}
+
+uint16_t transactions_slave_edge_time(uint8_t row) {
+    return slave_edge_time[row];
+}
+
+#else // SPLIT_MATRIX_DELTA
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t last_update = 0;
+    matrix_row_t    temp_matrix[(MATRIX_ROWS) / 2]; // holding area while we test whether or not checksum is correct
 
     bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
     if (okay) {
         // Checksum matches the received data, save as the last matrix state
-        memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+        memcpy(last_slave_matrix, temp_matrix, sizeof(temp_matrix));
     }
     // Copy out the last-known-good matrix state to the slave matrix
-    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    memcpy(slave_matrix, last_slave_matrix, sizeof(last_slave_matrix));
     return okay;
 }
 
+#endif // SPLIT_MATRIX_DELTA
+
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_MATRIX_DELTA
+    slave_matrix_queue_events(slave_matrix);
+#endif // SPLIT_MATRIX_DELTA
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#ifdef SPLIT_TRANSACTION_PACKED
+// The packed transaction handler reads the slave matrix instead, at the end of the cycle
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER()
+#else // SPLIT_TRANSACTION_PACKED
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#endif // SPLIT_TRANSACTION_PACKED
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
-    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix), \
+    TRANSACTIONS_SLAVE_EVENTS_REGISTRATIONS
+#ifdef SPLIT_MATRIX_DELTA
+#    define TRANSACTIONS_SLAVE_EVENTS_REGISTRATIONS \
+    [GET_SLAVE_MATRIX_SEQUENCE]      = trans_target2initiator_initializer(sevents.sequence), \
+    [GET_SLAVE_MATRIX_RECENT_EVENTS] = {0, 0, SLAVE_RECENT_EVENTS_SIZE, offsetof(split_shared_memory_t, sevents), NULL}, \
+    [GET_SLAVE_MATRIX_EVENTS]        = trans_target2initiator_initializer(sevents),
+#else // SPLIT_MATRIX_DELTA
+#    define TRANSACTIONS_SLAVE_EVENTS_REGISTRATIONS
+#endif // SPLIT_MATRIX_DELTA
 // clang-format on
 
+////////////////////////////////////////////////////
+// Packed frames
+
+#ifdef SPLIT_TRANSACTION_PACKED
+
+#    ifdef SPLIT_MATRIX_DELTA
+// The slave replies to a packed frame with the last sequence it unpacked, its key changes are read from the event queue
+#        define PACKED_RESPONSE_SIZE sizeof_member(split_shared_memory_t, packed_ack)
+#    else // SPLIT_MATRIX_DELTA
+// The slave replies to a packed frame with the last sequence it unpacked, followed by its matrix
+#        define PACKED_RESPONSE_SIZE (offsetof(split_shared_memory_t, smatrix) + sizeof(split_slave_matrix_sync_t) - offsetof(split_shared_memory_t, packed_ack))
+#    endif // SPLIT_MATRIX_DELTA
+
+STATIC_ASSERT(sizeof(split_packed_sync_t) <= UINT8_MAX, "SPLIT_TRANSACTION_PACKED_SIZE too large");
+STATIC_ASSERT(PACKED_RESPONSE_SIZE <= UINT8_MAX, "Slave matrix too large for a packed frame response");
+
+static uint8_t packed_frame_checksum(const split_packed_sync_t *frame) {
+    split_packed_sync_t temp = *frame;
+    temp.checksum            = 0;
+    return crc8(&temp, sizeof(temp));
+}
+
+static bool packed_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t inflight = 0; // sections sent but not yet unpacked by the slave
+    static uint8_t  sequence = 0;
+    static uint8_t  section_first[NUM_TOTAL_TRANSACTIONS];    // first frame of the unbroken run carrying the current data
+    static uint8_t  section_sequence[NUM_TOTAL_TRANSACTIONS]; // last frame carrying the section
+
+    // The slave only unpacks the latest frame it received, so keep resending each section until it has
+    // acknowledged a frame that carried its current data. A section left out of a frame because the payload
+    // overflowed isn't delivered by that frame, so the acknowledged frame has to be within the run.
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if ((inflight & ((uint32_t)1 << id)) && (int8_t)(split_shmem->packed_ack - section_first[id]) >= 0 && (int8_t)(section_sequence[id] - split_shmem->packed_ack) >= 0) {
+            inflight &= ~((uint32_t)1 << id);
+        }
+    }
+
+    uint32_t sections = packed_pending | inflight;
+    if (!sections) {
+        return slave_matrix_handlers_master(master_matrix, slave_matrix);
+    }
+
+    split_packed_sync_t frame  = {0};
+    uint8_t             length = 0;
+    frame.sequence             = sequence + 1;
+    if (frame.sequence == 0) {
+        // The slave starts out having acknowledged sequence 0
+        frame.sequence = 1;
+    }
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        // Anything that doesn't fit waits for the next frame
+        if (!(sections & ((uint32_t)1 << id)) || length + trans->initiator2target_buffer_size > sizeof(frame.payload)) {
+            continue;
+        }
+        memcpy(&frame.payload[length], split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        length += trans->initiator2target_buffer_size;
+        frame.sections |= (uint32_t)1 << id;
+    }
+    frame.checksum = packed_frame_checksum(&frame);
+
+    uint8_t response[PACKED_RESPONSE_SIZE];
+    bool    okay = transport_execute_transaction(PUT_PACKED, &frame, sizeof(frame), response, sizeof(response));
+    if (okay) {
+        for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+            if (!(frame.sections & ((uint32_t)1 << id))) {
+                continue;
+            }
+            if ((packed_pending & ((uint32_t)1 << id)) || section_sequence[id] != sequence) {
+                section_first[id] = frame.sequence;
+            }
+            section_sequence[id] = frame.sequence;
+        }
+        sequence = frame.sequence;
+        inflight |= frame.sections;
+        packed_pending &= ~frame.sections;
+#ifndef SPLIT_MATRIX_DELTA
+
+        okay = split_shmem->smatrix.checksum == crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+        if (okay) {
+            memcpy(last_slave_matrix, split_shmem->smatrix.matrix, sizeof(last_slave_matrix));
+        }
+#endif // SPLIT_MATRIX_DELTA
+    }
+#ifdef SPLIT_MATRIX_DELTA
+    // Key events have to be replayed in order, so they are always read from the event queue
+    return okay && slave_matrix_handlers_master(master_matrix, slave_matrix);
+#else // SPLIT_MATRIX_DELTA
+    memcpy(slave_matrix, last_slave_matrix, sizeof(last_slave_matrix));
+    return okay;
+#endif // SPLIT_MATRIX_DELTA
+}
+
+static void packed_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    if (split_shmem->packed.sequence == split_shmem->packed_ack) {
+        return;
+    }
+
+    split_packed_sync_t frame;
+    memcpy(&frame, &split_shmem->packed, sizeof(frame));
+    if (frame.checksum != packed_frame_checksum(&frame)) {
+        // Partially received, try again once the rest has arrived
+        return;
+    }
+
+    uint8_t length = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (!(frame.sections & ((uint32_t)1 << id)) || length + trans->initiator2target_buffer_size > sizeof(frame.payload)) {
+            continue;
+        }
+        memcpy(split_trans_initiator2target_buffer(trans), &frame.payload[length], trans->initiator2target_buffer_size);
+        length += trans->initiator2target_buffer_size;
+    }
+    split_shmem->packed_ack = frame.sequence;
+}
+
+// clang-format off
+#    define TRANSACTIONS_PACKED_MASTER() TRANSACTION_HANDLER_MASTER(packed)
+#    define TRANSACTIONS_PACKED_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(packed)
+#    define TRANSACTIONS_PACKED_REGISTRATIONS \
+    [PUT_PACKED] = {sizeof_member(split_shared_memory_t, packed), offsetof(split_shared_memory_t, packed), PACKED_RESPONSE_SIZE, offsetof(split_shared_memory_t, packed_ack), NULL},
+// clang-format on
+
+#else // SPLIT_TRANSACTION_PACKED
+
+#    define TRANSACTIONS_PACKED_MASTER()
+#    define TRANSACTIONS_PACKED_SLAVE()
+#    define TRANSACTIONS_PACKED_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTION_PACKED
+
 ////////////////////////////////////////////////////
 // Master matrix
 
@@ -427,7 +736,7 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
 
     bool okay = true;
     if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
+        okay &= transport_stage(PUT_MODS, &new_mods, sizeof(new_mods));
         if (okay) {
             last_update = timer_read32();
         }
@@ -926,6 +1235,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 
     // clang-format off
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
+    TRANSACTIONS_PACKED_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
     TRANSACTIONS_SYNC_TIMER_REGISTRATIONS
@@ -974,10 +1284,12 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_PACKED_MASTER();
     return true;
 }
 
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_PACKED_SLAVE();
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
     TRANSACTIONS_ENCODERS_SLAVE();
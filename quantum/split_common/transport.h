@@ -57,6 +57,31 @@ typedef struct _split_slave_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_MATRIX_DELTA
+#    ifndef SPLIT_MATRIX_EVENT_COUNT
+#        define SPLIT_MATRIX_EVENT_COUNT 8
+#    endif // SPLIT_MATRIX_EVENT_COUNT
+#    ifndef SPLIT_MATRIX_EVENT_RECENT
+#        define SPLIT_MATRIX_EVENT_RECENT 2
+#    endif // SPLIT_MATRIX_EVENT_RECENT
+
+#    define SPLIT_MATRIX_EVENT_PRESSED 0x80
+
+typedef struct _split_matrix_event_t {
+    uint8_t  row; // SPLIT_MATRIX_EVENT_PRESSED is set for a key press
+    uint8_t  col;
+    uint16_t time; // sync_timer_read() when the slave saw the change
+} split_matrix_event_t;
+
+// The master usually only reads the leading recent_checksum, sequence and the SPLIT_MATRIX_EVENT_RECENT newest events
+typedef struct _split_slave_events_sync_t {
+    uint8_t              recent_checksum;                  // covers the sequence and the SPLIT_MATRIX_EVENT_RECENT newest events
+    uint8_t              sequence;                         // sequence number of the newest event
+    split_matrix_event_t events[SPLIT_MATRIX_EVENT_COUNT]; // newest first, event N is stored at events[sequence - N]
+    uint8_t              checksum;                         // covers the sequence and all events
+} split_slave_events_sync_t;
+#endif // SPLIT_MATRIX_DELTA
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -147,13 +172,35 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSACTION_PACKED
+#    ifndef SPLIT_TRANSACTION_PACKED_SIZE
+#        define SPLIT_TRANSACTION_PACKED_SIZE 32
+#    endif // SPLIT_TRANSACTION_PACKED_SIZE
+
+typedef struct _split_packed_sync_t {
+    uint32_t sections; // bitmap of the transaction IDs present in the payload
+    uint8_t  sequence;
+    uint8_t  checksum;
+    uint8_t  payload[SPLIT_TRANSACTION_PACKED_SIZE];
+} split_packed_sync_t;
+#endif // SPLIT_TRANSACTION_PACKED
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSACTION_PACKED
+    // Sent back in reply to a packed frame, along with smatrix unless SPLIT_MATRIX_DELTA is used, so must directly precede it
+    uint8_t packed_ack;
+#endif // SPLIT_TRANSACTION_PACKED
+
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_MATRIX_DELTA
+    split_slave_events_sync_t sevents;
+#endif // SPLIT_MATRIX_DELTA
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -231,6 +278,10 @@ typedef struct _split_shared_memory_t {
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
     os_variant_t detected_os;
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
+
+#ifdef SPLIT_TRANSACTION_PACKED
+    split_packed_sync_t packed;
+#endif // SPLIT_TRANSACTION_PACKED
 } split_shared_memory_t;
 
 extern split_shared_memory_t *const split_shmem;
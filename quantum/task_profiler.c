@@ -0,0 +1,224 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "task_profiler.h"
+#include "timer.h"
+#include "debug.h"
+#include "util.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#elif defined(__AVR__)
+#    include <avr/io.h>
+#    include "timer_avr.h"
+#endif
+
+// Durations are binned per power of two, p99 is reported as the upper bound of its bin.
+// The last bin is open ended, a p99 that falls into it is reported as the maximum.
+#ifndef TASK_PROFILER_BUCKETS
+#    if defined(__AVR__)
+// 2^15 timer ticks is over 100ms
+#        define TASK_PROFILER_BUCKETS 16
+#    else
+// 2^23 cycles is 50ms at 168MHz
+#        define TASK_PROFILER_BUCKETS 24
+#    endif
+#endif
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    // Running sum of the last sum_count samples, both are halved before the sum overflows
+    uint32_t sum;
+    uint16_t sum_count;
+    uint8_t  histogram[TASK_PROFILER_BUCKETS];
+} task_profiler_stats_t;
+
+static task_profiler_stats_t task_profiler_stats[TASK_PROFILER_COUNT];
+
+static const char *const task_profiler_names[TASK_PROFILER_COUNT] = {
+    [TASK_PROFILER_MATRIX]           = "matrix",
+    [TASK_PROFILER_SPLIT_TRANSPORT]  = "split_transport",
+    [TASK_PROFILER_QUANTUM]          = "quantum",
+    [TASK_PROFILER_SPLIT_WATCHDOG]   = "split_watchdog",
+    [TASK_PROFILER_RGBLIGHT]         = "rgblight",
+    [TASK_PROFILER_LED_MATRIX]       = "led_matrix",
+    [TASK_PROFILER_RGB_MATRIX]       = "rgb_matrix",
+    [TASK_PROFILER_BACKLIGHT]        = "backlight",
+    [TASK_PROFILER_ENCODER]          = "encoder",
+    [TASK_PROFILER_POINTING_DEVICE]  = "pointing_device",
+    [TASK_PROFILER_OLED]             = "oled",
+    [TASK_PROFILER_ST7565]           = "st7565",
+    [TASK_PROFILER_MOUSEKEY]         = "mousekey",
+    [TASK_PROFILER_PS2_MOUSE]        = "ps2_mouse",
+    [TASK_PROFILER_MIDI]             = "midi",
+    [TASK_PROFILER_JOYSTICK]         = "joystick",
+    [TASK_PROFILER_BATTERY]          = "battery",
+    [TASK_PROFILER_BLUETOOTH]        = "bluetooth",
+    [TASK_PROFILER_HAPTIC]           = "haptic",
+    [TASK_PROFILER_LED]              = "led",
+    [TASK_PROFILER_OS_DETECTION]     = "os_detection",
+    [TASK_PROFILER_PROTOCOL_PRE]     = "protocol_pre",
+    [TASK_PROFILER_PROTOCOL_POST]    = "protocol_post",
+    [TASK_PROFILER_RAW_HID]          = "raw_hid",
+    [TASK_PROFILER_CONSOLE]          = "console",
+    [TASK_PROFILER_QUANTUM_PAINTER]  = "quantum_painter",
+    [TASK_PROFILER_DEFERRED_EXEC]    = "deferred_exec",
+    [TASK_PROFILER_HOUSEKEEPING]     = "housekeeping",
+    [TASK_PROFILER_USER_0]           = "user_0",
+    [TASK_PROFILER_USER_1]           = "user_1",
+    [TASK_PROFILER_USER_2]           = "user_2",
+    [TASK_PROFILER_USER_3]           = "user_3",
+};
+
+__attribute__((weak)) uint32_t task_profiler_timestamp(void) {
+#if defined(PROTOCOL_CHIBIOS)
+    return chSysGetRealtimeCounterX();
+#elif defined(__AVR__)
+    // Extend the 8-bit timer with the millisecond count
+    uint32_t ms;
+    uint8_t  ticks;
+    do {
+        ms    = timer_read32();
+        ticks = TIMER_RAW;
+    } while (ms != timer_read32());
+    return ms * TIMER_RAW_TOP + ticks;
+#else
+    return timer_read32();
+#endif
+}
+
+static uint8_t task_profiler_bucket(uint32_t elapsed) {
+    uint8_t bucket = 0;
+    while (elapsed > 1 && bucket < TASK_PROFILER_BUCKETS - 1) {
+        elapsed >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void task_profiler_record(task_profiler_id_t id, uint32_t elapsed) {
+    if (id >= TASK_PROFILER_COUNT) {
+        return;
+    }
+
+    task_profiler_stats_t *stats = &task_profiler_stats[id];
+    if (stats->count == 0 || elapsed < stats->min) {
+        stats->min = elapsed;
+    }
+    if (elapsed > stats->max) {
+        stats->max = elapsed;
+    }
+    stats->count++;
+
+    while (stats->sum > UINT32_MAX - elapsed || stats->sum_count == UINT16_MAX) {
+        // Halve both, keeping the average
+        stats->sum_count >>= 1;
+        stats->sum = stats->sum_count ? stats->sum >> 1 : 0;
+    }
+    stats->sum += elapsed;
+    stats->sum_count++;
+
+    uint8_t bucket = task_profiler_bucket(elapsed);
+    if (stats->histogram[bucket] == UINT8_MAX) {
+        // Halve all bins, keeping their proportions
+        for (uint8_t i = 0; i < TASK_PROFILER_BUCKETS; i++) {
+            stats->histogram[i] >>= 1;
+        }
+    }
+    stats->histogram[bucket]++;
+}
+
+static uint32_t task_profiler_p99(const task_profiler_stats_t *stats) {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < TASK_PROFILER_BUCKETS; i++) {
+        total += stats->histogram[i];
+    }
+
+    // Find the first bin at which 99% of the samples have been seen
+    uint32_t threshold = (total * 99 + 99) / 100;
+    uint32_t seen      = 0;
+    for (uint8_t i = 0; i < TASK_PROFILER_BUCKETS; i++) {
+        seen += stats->histogram[i];
+        if (seen >= threshold) {
+            uint32_t upper = (i >= TASK_PROFILER_BUCKETS - 1) ? UINT32_MAX : ((uint32_t)2 << i) - 1;
+            return MIN(upper, stats->max);
+        }
+    }
+    return stats->max;
+}
+
+bool task_profiler_get(task_profiler_id_t id, task_profiler_summary_t *summary) {
+    if (id >= TASK_PROFILER_COUNT) {
+        return false;
+    }
+
+    const task_profiler_stats_t *stats = &task_profiler_stats[id];
+    summary->count                     = stats->count;
+    if (stats->count == 0) {
+        summary->min = summary->avg = summary->max = summary->p99 = 0;
+        return true;
+    }
+
+    summary->min = stats->min;
+    summary->avg = stats->sum / stats->sum_count;
+    summary->max = stats->max;
+    summary->p99 = task_profiler_p99(stats);
+    return true;
+}
+
+const char *task_profiler_name(task_profiler_id_t id) {
+    return id < TASK_PROFILER_COUNT ? task_profiler_names[id] : "";
+}
+
+void task_profiler_reset(void) {
+    memset(task_profiler_stats, 0, sizeof(task_profiler_stats));
+}
+
+void task_profiler_print(void) {
+    dprintf("%-16s %10s %10s %10s %10s %10s\n", "task", "count", "min", "avg", "max", "p99");
+    for (uint8_t id = 0; id < TASK_PROFILER_COUNT; id++) {
+        task_profiler_summary_t summary;
+        task_profiler_get(id, &summary);
+        if (summary.count == 0) {
+            continue;
+        }
+        dprintf("%-16s %10lu %10lu %10lu %10lu %10lu\n", task_profiler_name(id), (unsigned long)summary.count, (unsigned long)summary.min, (unsigned long)summary.avg, (unsigned long)summary.max, (unsigned long)summary.p99);
+    }
+}
+
+void task_profiler_task(void) {
+#ifdef CONSOLE_ENABLE
+    static uint32_t last_report = 0;
+    if (timer_elapsed32(last_report) >= TASK_PROFILER_REPORT_INTERVAL) {
+        last_report = timer_read32();
+        task_profiler_print();
+    }
+#endif
+}
+
+static uint8_t task_profiler_write_u32(uint8_t *data, uint32_t value) {
+    data[0] = (value >> 24) & 0xFF;
+    data[1] = (value >> 16) & 0xFF;
+    data[2] = (value >> 8) & 0xFF;
+    data[3] = value & 0xFF;
+    return 4;
+}
+
+uint8_t task_profiler_serialize(uint8_t id, uint8_t *data, uint8_t length) {
+    task_profiler_summary_t summary;
+    if (length < TASK_PROFILER_SERIALIZED_SIZE || !task_profiler_get(id, &summary)) {
+        return 0;
+    }
+
+    uint8_t i = 0;
+    data[i++] = TASK_PROFILER_COUNT;
+    i += task_profiler_write_u32(&data[i], summary.count);
+    i += task_profiler_write_u32(&data[i], summary.min);
+    i += task_profiler_write_u32(&data[i], summary.avg);
+    i += task_profiler_write_u32(&data[i], summary.max);
+    i += task_profiler_write_u32(&data[i], summary.p99);
+    return i;
+}
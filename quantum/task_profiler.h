@@ -0,0 +1,111 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    Per-task CPU time accounting for the main loop.
+
+    With TASK_PROFILER_ENABLE = yes, every stage of keyboard_task() and the main
+    loop is timed and min/avg/max/p99 durations are kept per stage. They are
+    printed on the console every TASK_PROFILER_REPORT_INTERVAL milliseconds, and
+    can be read over raw HID with task_profiler_serialize().
+
+    Other code can be profiled in the same way, using one of the user slots:
+
+        TASK_PROFILE(TASK_PROFILER_USER_0, my_expensive_task());
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum {
+    TASK_PROFILER_MATRIX,
+    TASK_PROFILER_SPLIT_TRANSPORT,
+    TASK_PROFILER_QUANTUM,
+    TASK_PROFILER_SPLIT_WATCHDOG,
+    TASK_PROFILER_RGBLIGHT,
+    TASK_PROFILER_LED_MATRIX,
+    TASK_PROFILER_RGB_MATRIX,
+    TASK_PROFILER_BACKLIGHT,
+    TASK_PROFILER_ENCODER,
+    TASK_PROFILER_POINTING_DEVICE,
+    TASK_PROFILER_OLED,
+    TASK_PROFILER_ST7565,
+    TASK_PROFILER_MOUSEKEY,
+    TASK_PROFILER_PS2_MOUSE,
+    TASK_PROFILER_MIDI,
+    TASK_PROFILER_JOYSTICK,
+    TASK_PROFILER_BATTERY,
+    TASK_PROFILER_BLUETOOTH,
+    TASK_PROFILER_HAPTIC,
+    TASK_PROFILER_LED,
+    TASK_PROFILER_OS_DETECTION,
+    TASK_PROFILER_PROTOCOL_PRE,
+    TASK_PROFILER_PROTOCOL_POST,
+    TASK_PROFILER_RAW_HID,
+    TASK_PROFILER_CONSOLE,
+    TASK_PROFILER_QUANTUM_PAINTER,
+    TASK_PROFILER_DEFERRED_EXEC,
+    TASK_PROFILER_HOUSEKEEPING,
+    TASK_PROFILER_USER_0,
+    TASK_PROFILER_USER_1,
+    TASK_PROFILER_USER_2,
+    TASK_PROFILER_USER_3,
+    TASK_PROFILER_COUNT,
+} task_profiler_id_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t avg;
+    uint32_t max;
+    uint32_t p99;
+} task_profiler_summary_t;
+
+#ifdef TASK_PROFILER_ENABLE
+
+#    ifndef TASK_PROFILER_REPORT_INTERVAL
+#        define TASK_PROFILER_REPORT_INTERVAL 5000
+#    endif
+
+// Size of the raw HID response written by task_profiler_serialize()
+#    define TASK_PROFILER_SERIALIZED_SIZE 21
+
+/**
+ * \brief Returns the current timestamp in the profiler's unit.
+ *
+ * This is CPU cycles on ChibiOS, timer ticks on AVR and milliseconds elsewhere.
+ */
+uint32_t task_profiler_timestamp(void);
+
+void        task_profiler_record(task_profiler_id_t id, uint32_t elapsed);
+bool        task_profiler_get(task_profiler_id_t id, task_profiler_summary_t *summary);
+const char *task_profiler_name(task_profiler_id_t id);
+void        task_profiler_reset(void);
+void        task_profiler_print(void);
+void        task_profiler_task(void);
+
+/**
+ * \brief Writes the summary of a task as big-endian values, for raw HID.
+ *
+ * Layout: task count, then count, min, avg, max and p99 of the given task.
+ *
+ * \return number of bytes written, 0 if the task or buffer is invalid
+ */
+uint8_t task_profiler_serialize(uint8_t id, uint8_t *data, uint8_t length);
+
+#    define TASK_PROFILE(id, call)                                                         \
+        do {                                                                               \
+            uint32_t task_profiler_start = task_profiler_timestamp();                      \
+            call;                                                                          \
+            task_profiler_record((id), task_profiler_timestamp() - task_profiler_start); \
+        } while (0)
+
+#else
+
+#    define TASK_PROFILE(id, call) \
+        do {                       \
+            call;                  \
+        } while (0)
+
+#endif // TASK_PROFILER_ENABLE
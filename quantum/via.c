@@ -33,6 +33,14 @@
 #include "version.h" // for QMK_BUILDDATE used in EEPROM magic
 #include "nvm_via.h"
 
+#ifdef TASK_PROFILER_ENABLE
+#    include "task_profiler.h"
+#endif
+
+#ifdef KEY_LATENCY_ENABLE
+#    include "key_latency.h"
+#endif
+
 #if defined(AUDIO_ENABLE)
 #    include "audio.h"
 #endif
@@ -264,6 +272,20 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
     }
 #endif // AUDIO_ENABLE
 
+#if defined(TASK_PROFILER_ENABLE)
+    if (*channel_id == id_qmk_task_profiler_channel) {
+        via_qmk_task_profiler_command(data, length);
+        return;
+    }
+#endif // TASK_PROFILER_ENABLE
+
+#if defined(KEY_LATENCY_ENABLE)
+    if (*channel_id == id_qmk_key_latency_channel) {
+        via_qmk_key_latency_command(data, length);
+        return;
+    }
+#endif // KEY_LATENCY_ENABLE
+
     (void)channel_id; // force use of variable
 
     // If we haven't returned before here, then let the keyboard level code
@@ -868,3 +890,73 @@ void via_qmk_audio_save(void) {
 }
 
 #endif // QMK_AUDIO_ENABLE
+
+#if defined(TASK_PROFILER_ENABLE)
+
+void via_qmk_task_profiler_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, task_id, summary ]
+    uint8_t *command_id = &(data[0]);
+    uint8_t *value_id   = &(data[2]);
+
+    if (*value_id != id_qmk_task_profiler_stats) {
+        *command_id = id_unhandled;
+        return;
+    }
+    switch (*command_id) {
+        case id_custom_set_value: {
+            task_profiler_reset();
+            break;
+        }
+        case id_custom_get_value: {
+            if (!task_profiler_serialize(data[3], &data[4], length - 4)) {
+                *command_id = id_unhandled;
+            }
+            break;
+        }
+        case id_custom_save: {
+            // Nothing is persisted
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+#endif // TASK_PROFILER_ENABLE
+
+#if defined(KEY_LATENCY_ENABLE)
+
+void via_qmk_key_latency_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, first_bucket, summary ]
+    uint8_t *command_id = &(data[0]);
+    uint8_t *value_id   = &(data[2]);
+
+    if (*value_id != id_qmk_key_latency_stats) {
+        *command_id = id_unhandled;
+        return;
+    }
+    switch (*command_id) {
+        case id_custom_set_value: {
+            key_latency_reset();
+            break;
+        }
+        case id_custom_get_value: {
+            if (!key_latency_serialize(data[3], &data[4], length - 4)) {
+                *command_id = id_unhandled;
+            }
+            break;
+        }
+        case id_custom_save: {
+            // Nothing is persisted
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+#endif // KEY_LATENCY_ENABLE
@@ -91,6 +91,9 @@ enum via_channel_id {
     id_qmk_rgb_matrix_channel = 3,
     id_qmk_audio_channel      = 4,
     id_qmk_led_matrix_channel = 5,
+    // Diagnostics, kept clear of the channels assigned from the bottom
+    id_qmk_task_profiler_channel = 0xF0,
+    id_qmk_key_latency_channel   = 0xF1,
 };
 
 enum via_qmk_backlight_value {
@@ -123,6 +126,14 @@ enum via_qmk_audio_value {
     id_qmk_audio_clicky_enable = 2,
 };
 
+enum via_qmk_task_profiler_value {
+    id_qmk_task_profiler_stats = 1,
+};
+
+enum via_qmk_key_latency_value {
+    id_qmk_key_latency_stats = 1,
+};
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void);
@@ -188,3 +199,11 @@ void via_qmk_audio_set_value(uint8_t *data);
 void via_qmk_audio_get_value(uint8_t *data);
 void via_qmk_audio_save(void);
 #endif
+
+#if defined(TASK_PROFILER_ENABLE)
+void via_qmk_task_profiler_command(uint8_t *data, uint8_t length);
+#endif
+
+#if defined(KEY_LATENCY_ENABLE)
+void via_qmk_key_latency_command(uint8_t *data, uint8_t length);
+#endif
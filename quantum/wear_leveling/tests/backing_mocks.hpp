@@ -96,6 +96,8 @@ class MockBackingStore {
     std::uint64_t backing_erase_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
+    // The number of reads, which don't otherwise alter the backing store
+    mutable std::uint64_t backing_read_invoke_count;
 
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
@@ -147,6 +149,10 @@ class MockBackingStore {
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    // Single and bulk reads both count as one, as each is a separate transfer for drivers such as SPI flash
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
 
     // Clear out the internal data for the next run
     void reset_instance();
@@ -162,6 +168,7 @@ class MockBackingStore {
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
+    bool read_bulk(std::uint32_t address, backing_store_int_t* values, std::size_t item_count) const;
 
     // Control over when init/writes/erases should succeed
     void set_init_callback(std::function<bool(std::uint64_t)> callback) {
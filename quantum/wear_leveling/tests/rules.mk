@@ -64,3 +64,18 @@ wear_leveling_8byte_SRC := \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
 	$(wear_leveling_common_INC)
+
+wear_leveling_write_back_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=4096 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024 \
+	-DWEAR_LEVELING_WRITE_BACK \
+	-DWEAR_LEVELING_WRITE_BACK_RANGES=4
+wear_leveling_write_back_SRC := \
+	$(wear_leveling_common_SRC) \
+	platforms/timer.c \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_write_back.cpp
+wear_leveling_write_back_INC := \
+	$(wear_leveling_common_INC)
@@ -3,4 +3,5 @@ TEST_LIST += \
 	wear_leveling_2byte_optimized_writes \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
-	wear_leveling_8byte
+	wear_leveling_8byte \
+	wear_leveling_write_back
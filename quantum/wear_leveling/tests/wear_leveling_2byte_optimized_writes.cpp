@@ -293,3 +293,39 @@ TEST_F(WearLeveling2ByteOptimizedWrites, PlaybackReadbackWord01_Success) {
     wear_leveling_read(0x02, &tmp, sizeof(tmp));
     EXPECT_EQ(tmp, 1) << "Failed to read back the seeded data";
 }
+
+/**
+ * This test fills most of the write log with a mix of entry types, then verifies that initialisation replays it using
+ * block reads from the backing store, rather than a read per log entry.
+ */
+TEST_F(WearLeveling2ByteOptimizedWrites, PlaybackReadsWriteLogInBlocks) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Clear things out
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+    inst.reset_instance();
+    wear_leveling_init();
+
+    // Single, optimised and multibyte writes, with entries straddling the playback block boundaries
+    for (uint32_t i = 0; i < 3000; ++i) {
+        uint8_t value[3] = {(uint8_t)(i + 1), (uint8_t)(i >> 8), 0x5A};
+        EXPECT_EQ(test_write((i * 37) % (WEAR_LEVELING_LOGICAL_SIZE - 3), value, 1 + i % 3), WEAR_LEVELING_SUCCESS) << "Write failed with incorrect status";
+    }
+    EXPECT_EQ(inst.erasure_count(), 0) << "Write log was consolidated, test needs fewer writes";
+
+    // Reboot, counting the reads from the backing store
+    std::uint64_t log_bytes   = inst.total_write_count() * BACKING_STORE_WRITE_SIZE;
+    std::uint64_t reads_start = inst.read_invoke_count();
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    std::uint64_t reads = inst.read_invoke_count() - reads_start;
+
+    // Consolidated data and its checksum, then one read per block of the write log, plus the block holding its end
+    EXPECT_LE(reads, 2 + (log_bytes / WEAR_LEVELING_PLAYBACK_BLOCK_SIZE) + 1) << "Too many backing store reads for " << log_bytes << " bytes of write log";
+    RecordProperty("write_log_bytes", std::to_string(log_bytes));
+    RecordProperty("backing_store_reads_per_boot", std::to_string(reads));
+
+    // Verify the data is what we expected
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback after playback did not match";
+}
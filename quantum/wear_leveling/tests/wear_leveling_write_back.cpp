@@ -0,0 +1,229 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class WearLevelingWriteBack : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Drop anything left pending by the previous test before the mock is reset
+        wear_leveling_sync();
+        MockBackingStore::Instance().reset_instance();
+        set_time(0);
+        wear_leveling_init();
+    }
+};
+
+static std::size_t log_size(const MockBackingStore& inst) {
+    return std::distance(inst.log_begin(), inst.log_end());
+}
+
+/**
+ * This test verifies that writes are served from the cache but don't reach the backing store until a sync.
+ */
+TEST_F(WearLevelingWriteBack, WritesAreDeferredUntilSync) {
+    auto&   inst       = MockBackingStore::Instance();
+    uint8_t test_value = 0x15;
+    EXPECT_EQ(wear_leveling_write(0x80, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(log_size(inst), 0) << "Write reached the backing store before a sync";
+
+    uint8_t readback = 0;
+    wear_leveling_read(0x80, &readback, sizeof(readback));
+    EXPECT_EQ(readback, test_value) << "Pending write not served from the cache";
+
+    EXPECT_EQ(wear_leveling_sync(), WEAR_LEVELING_SUCCESS) << "Sync returned incorrect status";
+    EXPECT_EQ(log_size(inst), 2) << "Sync did not commit a single multi-byte entry";
+    EXPECT_EQ(wear_leveling_sync(), WEAR_LEVELING_SUCCESS) << "Second sync returned incorrect status";
+    EXPECT_EQ(log_size(inst), 2) << "Second sync wrote to the backing store";
+}
+
+/**
+ * This test verifies that repeated writes to the same address are committed as a single write log entry.
+ */
+TEST_F(WearLevelingWriteBack, RepeatedWritesCoalesce) {
+    auto&                 inst = MockBackingStore::Instance();
+    wear_leveling_stats_t before;
+    wear_leveling_get_stats(&before);
+
+    for (uint8_t value = 1; value <= 100; ++value) {
+        EXPECT_EQ(wear_leveling_write(0x80, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    wear_leveling_sync();
+    EXPECT_EQ(log_size(inst), 2) << "Repeated writes were not coalesced";
+
+    wear_leveling_stats_t after;
+    wear_leveling_get_stats(&after);
+    EXPECT_EQ(after.coalesced - before.coalesced, 99) << "Incorrect coalesced count";
+    EXPECT_EQ(after.programs - before.programs, 2) << "Incorrect program count";
+
+    // Reload from the backing store and check the last value survived
+    wear_leveling_init();
+    uint8_t readback = 0;
+    wear_leveling_read(0x80, &readback, sizeof(readback));
+    EXPECT_EQ(readback, 100) << "Coalesced value was not persisted";
+}
+
+/**
+ * This test verifies that adjacent single-byte writes are merged into one multi-byte write log entry.
+ */
+TEST_F(WearLevelingWriteBack, AdjacentWritesMerge) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Write out of order to check merging on both sides of a pending range
+    const uint32_t order[] = {0x82, 0x81, 0x83, 0x80, 0x84};
+    for (auto address : order) {
+        uint8_t value = (uint8_t)address;
+        EXPECT_EQ(wear_leveling_write(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    wear_leveling_sync();
+    EXPECT_EQ(log_size(inst), 4) << "Adjacent writes were not merged into one 5-byte entry";
+
+    wear_leveling_init();
+    std::array<std::uint8_t, 5> readback;
+    wear_leveling_read(0x80, readback.data(), readback.size());
+    std::array<std::uint8_t, 5> expected;
+    std::iota(expected.begin(), expected.end(), 0x80);
+    EXPECT_EQ(readback, expected) << "Merged values were not persisted";
+}
+
+/**
+ * This test verifies that the task only commits once the flush delay has elapsed since the first pending write.
+ */
+TEST_F(WearLevelingWriteBack, TaskCommitsAfterFlushDelay) {
+    auto&   inst  = MockBackingStore::Instance();
+    uint8_t value = 0x20;
+    wear_leveling_write(0x80, &value, sizeof(value));
+
+    advance_time(WEAR_LEVELING_WRITE_BACK_FLUSH_DELAY - 1);
+    value = 0x21;
+    wear_leveling_write(0x90, &value, sizeof(value));
+    wear_leveling_task();
+    EXPECT_EQ(log_size(inst), 0) << "Task committed before the flush delay";
+
+    advance_time(1);
+    wear_leveling_task();
+    EXPECT_EQ(log_size(inst), 4) << "Task did not commit after the flush delay";
+}
+
+/**
+ * This test verifies that running out of pending ranges commits the existing ones and keeps the new write pending.
+ */
+TEST_F(WearLevelingWriteBack, FullRangeTableForcesCommit) {
+    auto& inst = MockBackingStore::Instance();
+    for (uint32_t i = 0; i < WEAR_LEVELING_WRITE_BACK_RANGES; ++i) {
+        uint8_t value = 0x30 + i;
+        wear_leveling_write(0x80 + (i * 0x10), &value, sizeof(value));
+    }
+    EXPECT_EQ(log_size(inst), 0) << "Writes reached the backing store before the range table was full";
+
+    uint8_t value = 0x55;
+    EXPECT_EQ(wear_leveling_write(0x200, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(log_size(inst), WEAR_LEVELING_WRITE_BACK_RANGES * 2) << "Full range table was not committed";
+
+    wear_leveling_sync();
+    EXPECT_EQ(log_size(inst), (WEAR_LEVELING_WRITE_BACK_RANGES + 1) * 2) << "Final write was not kept pending";
+}
+
+/**
+ * This test verifies that writes stay pending when the backing store fails, and that the task retries them.
+ */
+TEST_F(WearLevelingWriteBack, FailedSyncKeepsWritesPending) {
+    auto&   inst  = MockBackingStore::Instance();
+    uint8_t value = 0x15;
+    wear_leveling_write(0x80, &value, sizeof(value));
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return false; });
+    EXPECT_EQ(wear_leveling_sync(), WEAR_LEVELING_FAILED) << "Sync returned incorrect status";
+    advance_time(WEAR_LEVELING_WRITE_BACK_FLUSH_DELAY);
+    wear_leveling_task();
+    EXPECT_EQ(log_size(inst), 0) << "Failed sync reached the backing store";
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+    advance_time(WEAR_LEVELING_WRITE_BACK_FLUSH_DELAY - 1);
+    wear_leveling_task();
+    EXPECT_EQ(log_size(inst), 0) << "Task retried before the flush delay";
+
+    advance_time(1);
+    wear_leveling_task();
+    EXPECT_EQ(log_size(inst), 2) << "Task did not retry the failed sync";
+
+    wear_leveling_init();
+    uint8_t readback = 0;
+    wear_leveling_read(0x80, &readback, sizeof(readback));
+    EXPECT_EQ(readback, value) << "Write was lost after a failed sync";
+}
+
+/**
+ * This test verifies that a full range table keeps every write pending when the forced commit fails.
+ */
+TEST_F(WearLevelingWriteBack, FullRangeTableKeepsWritesWhenCommitFails) {
+    auto& inst = MockBackingStore::Instance();
+    for (uint32_t i = 0; i < WEAR_LEVELING_WRITE_BACK_RANGES; ++i) {
+        uint8_t value = 0x30 + i;
+        wear_leveling_write(0x80 + (i * 0x10), &value, sizeof(value));
+    }
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return false; });
+    uint8_t value = 0x55;
+    EXPECT_EQ(wear_leveling_write(0x200, &value, sizeof(value)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    EXPECT_EQ(log_size(inst), 0) << "Failed commit reached the backing store";
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+    EXPECT_NE(wear_leveling_sync(), WEAR_LEVELING_FAILED) << "Sync returned incorrect status";
+
+    wear_leveling_init();
+    for (uint32_t i = 0; i < WEAR_LEVELING_WRITE_BACK_RANGES; ++i) {
+        uint8_t readback = 0;
+        wear_leveling_read(0x80 + (i * 0x10), &readback, sizeof(readback));
+        EXPECT_EQ(readback, 0x30 + i) << "Pending write was lost after a failed commit";
+    }
+    uint8_t readback = 0;
+    wear_leveling_read(0x200, &readback, sizeof(readback));
+    EXPECT_EQ(readback, value) << "Write was lost after a failed commit";
+}
+
+/**
+ * This test verifies that re-initialisation commits pending writes rather than discarding them.
+ */
+TEST_F(WearLevelingWriteBack, InitCommitsPendingWrites) {
+    uint8_t value = 0x42;
+    wear_leveling_write(0x100, &value, sizeof(value));
+    wear_leveling_init();
+
+    uint8_t readback = 0;
+    wear_leveling_read(0x100, &readback, sizeof(readback));
+    EXPECT_EQ(readback, value) << "Pending write was lost on re-initialisation";
+}
+
+/**
+ * This test verifies that the program and erase counters match the operations seen by the backing store, including
+ * those performed during consolidation.
+ */
+TEST_F(WearLevelingWriteBack, StatsMatchBackingStore) {
+    auto&                 inst = MockBackingStore::Instance();
+    wear_leveling_stats_t before;
+    wear_leveling_get_stats(&before);
+    const auto writes_before = inst.total_write_count();
+    const auto erases_before = inst.erase_invoke_count();
+
+    // Enough distinct 5-byte writes to overflow the write log at least once
+    std::array<std::uint8_t, 5> block;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        std::fill(block.begin(), block.end(), (uint8_t)(i + 1));
+        wear_leveling_write((i * 5) % (WEAR_LEVELING_LOGICAL_SIZE - 5), block.data(), block.size());
+        wear_leveling_sync();
+    }
+
+    wear_leveling_stats_t after;
+    wear_leveling_get_stats(&after);
+    EXPECT_GT(after.erases - before.erases, 0) << "Test did not force a consolidation";
+    EXPECT_EQ(after.erases - before.erases, inst.erase_invoke_count() - erases_before) << "Erase count does not match the backing store";
+    EXPECT_EQ(after.programs - before.programs, inst.total_write_count() - writes_before) << "Program count does not match the backing store";
+}
@@ -6,6 +6,10 @@
 #include "wear_leveling_drivers.h"
 #include "wear_leveling_internal.h"
 
+#ifdef WEAR_LEVELING_WRITE_BACK
+#    include "timer.h"
+#endif // WEAR_LEVELING_WRITE_BACK
+
 /*
     This wear leveling algorithm is adapted from algorithms from previous
     implementations in QMK, namely:
@@ -62,6 +66,24 @@
             to other subsystems performing reads/writes. This must be a multiple
             of the write size.
 
+        - WEAR_LEVELING_PLAYBACK_BLOCK_SIZE: The number of bytes of write log
+            fetched per bulk read during playback. This must be a multiple of
+            the write size.
+
+        - WEAR_LEVELING_WRITE_BACK: If defined, writes are buffered in RAM and
+            committed to the write log by wear_leveling_task() or
+            wear_leveling_sync(). Overlapping and adjacent writes are merged
+            into single ranges, so repeated updates of the same values only
+            reach the backing store once.
+
+        - WEAR_LEVELING_WRITE_BACK_FLUSH_DELAY: The number of milliseconds
+            after the first buffered write before wear_leveling_task() commits
+            the buffered writes.
+
+        - WEAR_LEVELING_WRITE_BACK_RANGES: The number of distinct address
+            ranges which can be buffered. A write which cannot be merged into
+            an existing range when all are in use forces a commit.
+
     General algorithm:
 
         During initialization:
@@ -74,6 +96,8 @@
 
         During writes:
             * The cache is updated with the new data.
+            * If write-back is enabled, the written range is recorded and the
+                remaining steps are deferred until the next commit.
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
@@ -163,8 +187,28 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+    wear_leveling_stats_t                                          stats;
 } wear_leveling;
 
+/**
+ * Logical address range of the cache to be committed to the write log.
+ */
+typedef struct wear_leveling_range_t {
+    uint32_t address;
+    uint32_t length;
+} wear_leveling_range_t;
+
+#ifdef WEAR_LEVELING_WRITE_BACK
+/**
+ * Storage area for writes buffered by write-back.
+ */
+static struct {
+    wear_leveling_range_t ranges[(WEAR_LEVELING_WRITE_BACK_RANGES)];
+    uint8_t               count;
+    uint16_t              timer; // time of the first write since the last commit
+} wear_leveling_pending;
+#endif // WEAR_LEVELING_WRITE_BACK
+
 /**
  * Locking helper: status
  */
@@ -204,6 +248,9 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+#ifdef WEAR_LEVELING_WRITE_BACK
+    wear_leveling_pending.count = 0;
+#endif // WEAR_LEVELING_WRITE_BACK
 }
 
 /**
@@ -262,6 +309,8 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
     if (!backing_store_write_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to write to backing store\n");
         status = WEAR_LEVELING_FAILED;
+    } else {
+        wear_leveling.stats.programs += sizeof(wear_leveling.cache) / sizeof(backing_store_int_t);
     }
 
     if (status != WEAR_LEVELING_FAILED) {
@@ -286,6 +335,7 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
                 break;
             }
 #endif
+            wear_leveling.stats.programs += sizeof(entry) / sizeof(backing_store_int_t);
         } while (0);
     }
 
@@ -309,6 +359,7 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
         wl_dprintf("Failed to erase backing store\n");
         return WEAR_LEVELING_FAILED;
     }
+    wear_leveling.stats.erases++;
 
     // Write the cache to the first section of the backing store.
     wear_leveling_status_t status = wear_leveling_write_consolidated();
@@ -348,6 +399,7 @@ static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value
         wl_dprintf("Failed to write to backing store\n");
         return WEAR_LEVELING_FAILED;
     }
+    wear_leveling.stats.programs++;
     wear_leveling.write_address += (BACKING_STORE_WRITE_SIZE);
     return wear_leveling_consolidate_if_needed();
 }
@@ -470,18 +522,49 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+/**
+ * Block of the write log read from the backing store during playback.
+ */
+typedef struct wear_leveling_playback_block_t {
+    backing_store_int_t values[(WEAR_LEVELING_PLAYBACK_BLOCK_SIZE) / (BACKING_STORE_WRITE_SIZE)];
+    uint32_t            address; // backing store address of values[0]
+    uint32_t            length;  // number of bytes held in values
+} wear_leveling_playback_block_t;
+
+/**
+ * Reads a value from the write log during playback, fetching a whole block from the backing store at a time so that
+ * drivers with bulk reads (such as external SPI flash) don't need a separate transfer for every log entry.
+ */
+static bool wear_leveling_playback_read(wear_leveling_playback_block_t *block, uint32_t address, backing_store_int_t *value) {
+    if (address < block->address || address >= block->address + block->length) {
+        uint32_t length = (WEAR_LEVELING_BACKING_SIZE) - address;
+        if (length > sizeof(block->values)) {
+            length = sizeof(block->values);
+        }
+        if (!backing_store_read_bulk(address, block->values, length / (BACKING_STORE_WRITE_SIZE))) {
+            block->length = 0;
+            return false;
+        }
+        block->address = address;
+        block->length  = length;
+    }
+    *value = block->values[(address - block->address) / (BACKING_STORE_WRITE_SIZE)];
+    return true;
+}
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
 static wear_leveling_status_t wear_leveling_playback_log(void) {
     wl_dprintf("Playback write log\n");
 
-    wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
-    bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling_playback_block_t block           = {.length = 0};
+    wear_leveling_status_t         status          = WEAR_LEVELING_SUCCESS;
+    bool                           cancel_playback = false;
+    uint32_t                       address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
     while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = wear_leveling_playback_read(&block, address, &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -510,7 +593,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                ok = wear_leveling_playback_read(&block, address, &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -530,7 +613,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
 #if BACKING_STORE_WRITE_SIZE == 2
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = wear_leveling_playback_read(&block, address, &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -540,7 +623,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = wear_leveling_playback_read(&block, address, &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -551,7 +634,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = wear_leveling_playback_read(&block, address, &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -612,12 +695,113 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     return status;
 }
 
+/**
+ * Appends the supplied ranges of the cache to the write log, consolidating if required.
+ */
+static wear_leveling_status_t wear_leveling_commit(const wear_leveling_range_t *ranges, size_t count) {
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Perform the actual writes
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (size_t i = 0; i < count && status == WEAR_LEVELING_SUCCESS; ++i) {
+        status = wear_leveling_write_raw(ranges[i].address, &wear_leveling.cache[ranges[i].address], ranges[i].length);
+    }
+
+    switch (status) {
+        case WEAR_LEVELING_CONSOLIDATED:
+        case WEAR_LEVELING_FAILED:
+            // If a write triggered consolidation, the whole cache (including any remaining ranges) is already in the
+            // consolidated area. If a write failed, then nothing else needs to occur.
+            break;
+
+        case WEAR_LEVELING_SUCCESS:
+            // Consolidate the cache + write log if required
+            status = wear_leveling_consolidate_if_needed();
+            break;
+
+        default:
+            // Unsure how we'd get here...
+            status = WEAR_LEVELING_FAILED;
+            break;
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+#ifdef WEAR_LEVELING_WRITE_BACK
+/**
+ * Records a range of the cache as pending, merging it with any pending ranges it overlaps or abuts.
+ * Pending ranges never overlap or abut each other, so a single pass is enough to absorb all of them.
+ */
+static wear_leveling_status_t wear_leveling_defer(uint32_t address, size_t length) {
+    uint32_t start  = address;
+    uint32_t end    = address + (uint32_t)length;
+    bool     merged = false;
+    for (uint8_t i = 0; i < wear_leveling_pending.count;) {
+        const wear_leveling_range_t *range = &wear_leveling_pending.ranges[i];
+        if (range->address <= end && start <= range->address + range->length) {
+            if (range->address < start) {
+                start = range->address;
+            }
+            if (range->address + range->length > end) {
+                end = range->address + range->length;
+            }
+            wear_leveling_pending.ranges[i] = wear_leveling_pending.ranges[--wear_leveling_pending.count];
+            merged                          = true;
+        } else {
+            ++i;
+        }
+    }
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    if (merged) {
+        wear_leveling.stats.coalesced++;
+    } else if (wear_leveling_pending.count == (WEAR_LEVELING_WRITE_BACK_RANGES)) {
+        // No room for another range, commit what we have so far
+        status = wear_leveling_sync();
+        if (status == WEAR_LEVELING_FAILED) {
+            // Still no room, fold everything into one range covering it all -- the cache holds the correct data in between
+            for (uint8_t i = 0; i < wear_leveling_pending.count; ++i) {
+                const wear_leveling_range_t *range = &wear_leveling_pending.ranges[i];
+                if (range->address < start) {
+                    start = range->address;
+                }
+                if (range->address + range->length > end) {
+                    end = range->address + range->length;
+                }
+            }
+            wear_leveling_pending.count = 0;
+        }
+    }
+
+    if (wear_leveling_pending.count == 0) {
+        wear_leveling_pending.timer = timer_read();
+    }
+    wear_leveling_pending.ranges[wear_leveling_pending.count++] = (wear_leveling_range_t){.address = start, .length = end - start};
+    return status;
+}
+#endif // WEAR_LEVELING_WRITE_BACK
+
 /**
  * Wear-leveling initialization
  */
 wear_leveling_status_t wear_leveling_init(void) {
     wl_dprintf("Init\n");
 
+    // Commit anything still buffered, as re-initialisation reloads the cache from the backing store
+    wear_leveling_sync();
+
     // Reset the cache
     wear_leveling_clear_cache();
 
@@ -662,6 +846,9 @@ wear_leveling_status_t wear_leveling_erase(void) {
 
     // Perform the erase
     bool ret = backing_store_erase();
+    if (ret) {
+        wear_leveling.stats.erases++;
+    }
     wear_leveling_clear_cache();
 
     // Lock the backing store if we acquired the lock successfully
@@ -692,39 +879,12 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
-    // Unlock the backing store
-    backing_store_lock_status_t lock_status = wear_leveling_unlock();
-    if (lock_status == STATUS_FAILURE) {
-        wear_leveling_lock();
-        return WEAR_LEVELING_FAILED;
-    }
-
-    // Perform the actual write
-    wear_leveling_status_t status = wear_leveling_write_raw(address, value, length);
-    switch (status) {
-        case WEAR_LEVELING_CONSOLIDATED:
-        case WEAR_LEVELING_FAILED:
-            // If the write triggered consolidation, or the write failed, then nothing else needs to occur.
-            break;
-
-        case WEAR_LEVELING_SUCCESS:
-            // Consolidate the cache + write log if required
-            status = wear_leveling_consolidate_if_needed();
-            break;
-
-        default:
-            // Unsure how we'd get here...
-            status = WEAR_LEVELING_FAILED;
-            break;
-    }
-
-    if (lock_status == STATUS_SUCCESS) {
-        if (wear_leveling_lock() == STATUS_FAILURE) {
-            status = WEAR_LEVELING_FAILED;
-        }
-    }
-
-    return status;
+#ifdef WEAR_LEVELING_WRITE_BACK
+    return wear_leveling_defer(address, length);
+#else
+    const wear_leveling_range_t range = {.address = address, .length = length};
+    return wear_leveling_commit(&range, 1);
+#endif // WEAR_LEVELING_WRITE_BACK
 }
 
 /**
@@ -744,6 +904,47 @@ wear_leveling_status_t wear_leveling_read(const uint32_t address, void *value, s
     return WEAR_LEVELING_SUCCESS;
 }
 
+/**
+ * Commits any buffered writes to the backing store.
+ */
+wear_leveling_status_t wear_leveling_sync(void) {
+#ifdef WEAR_LEVELING_WRITE_BACK
+    if (wear_leveling_pending.count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Sync %d pending ranges\n", (int)wear_leveling_pending.count);
+    wear_leveling_status_t status = wear_leveling_commit(wear_leveling_pending.ranges, wear_leveling_pending.count);
+    if (status == WEAR_LEVELING_FAILED) {
+        // Keep everything pending, wear_leveling_task() retries once the flush delay has elapsed again
+        wear_leveling_pending.timer = timer_read();
+        return status;
+    }
+    wear_leveling_pending.count = 0;
+    return status;
+#else
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_WRITE_BACK
+}
+
+/**
+ * Commits buffered writes once the flush delay has elapsed.
+ */
+void wear_leveling_task(void) {
+#ifdef WEAR_LEVELING_WRITE_BACK
+    if (wear_leveling_pending.count > 0 && timer_elapsed(wear_leveling_pending.timer) >= (WEAR_LEVELING_WRITE_BACK_FLUSH_DELAY)) {
+        wear_leveling_sync();
+    }
+#endif // WEAR_LEVELING_WRITE_BACK
+}
+
+/**
+ * Retrieves the backing store operation counters.
+ */
+void wear_leveling_get_stats(wear_leveling_stats_t *stats) {
+    *stats = wear_leveling.stats;
+}
+
 /**
  * Weak implementation of bulk read, drivers can implement more optimised implementations.
  */
@@ -13,6 +13,15 @@ typedef enum wear_leveling_status_t {
     WEAR_LEVELING_CONSOLIDATED //< Invocation succeeded, consolidation occurred
 } wear_leveling_status_t;
 
+/**
+ * @typedef Counters of the operations performed on the backing store since startup.
+ */
+typedef struct wear_leveling_stats_t {
+    uint32_t programs;  //< Number of backing store writes, each of BACKING_STORE_WRITE_SIZE bytes
+    uint32_t erases;    //< Number of backing store erasures
+    uint32_t coalesced; //< Number of logical writes merged into already-pending writes (WEAR_LEVELING_WRITE_BACK only)
+} wear_leveling_stats_t;
+
 /**
  * Wear-leveling initialization
  *
@@ -52,3 +61,25 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Commits any writes buffered by WEAR_LEVELING_WRITE_BACK to the backing store.
+ *
+ * Invoked periodically by wear_leveling_task(), and should be invoked before power is removed. Does nothing if there
+ * are no pending writes, or if write-back is disabled. If the commit fails, the writes stay pending to be retried.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_sync(void);
+
+/**
+ * Commits buffered writes once WEAR_LEVELING_WRITE_BACK_FLUSH_DELAY has elapsed since the first of them was made.
+ */
+void wear_leveling_task(void);
+
+/**
+ * Retrieves the backing store operation counters.
+ *
+ * @param stats[out] the destination for the counters
+ */
+void wear_leveling_get_stats(wear_leveling_stats_t* stats);
@@ -59,10 +59,30 @@ typedef uint64_t backing_store_int_t;
         } while (0)
 #endif // WEAR_LEVELING_ASSERTS
 
+// Number of bytes of the write log read from the backing store at a time during playback
+#ifndef WEAR_LEVELING_PLAYBACK_BLOCK_SIZE
+#    define WEAR_LEVELING_PLAYBACK_BLOCK_SIZE 64
+#endif // WEAR_LEVELING_PLAYBACK_BLOCK_SIZE
+
+#ifdef WEAR_LEVELING_WRITE_BACK
+// Time in milliseconds after the first buffered write before pending writes are committed to the write log
+#    ifndef WEAR_LEVELING_WRITE_BACK_FLUSH_DELAY
+#        define WEAR_LEVELING_WRITE_BACK_FLUSH_DELAY 1000
+#    endif // WEAR_LEVELING_WRITE_BACK_FLUSH_DELAY
+// Number of distinct address ranges that can be buffered before a flush is forced
+#    ifndef WEAR_LEVELING_WRITE_BACK_RANGES
+#        define WEAR_LEVELING_WRITE_BACK_RANGES 8
+#    endif // WEAR_LEVELING_WRITE_BACK_RANGES
+#endif     // WEAR_LEVELING_WRITE_BACK
+
 // Compile-time validation of configurable options
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 STATIC_ASSERT(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+STATIC_ASSERT(WEAR_LEVELING_PLAYBACK_BLOCK_SIZE >= 8 && WEAR_LEVELING_PLAYBACK_BLOCK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Playback block size must be a multiple of write size, and at least 8");
+#ifdef WEAR_LEVELING_WRITE_BACK
+STATIC_ASSERT(WEAR_LEVELING_WRITE_BACK_RANGES > 0 && WEAR_LEVELING_WRITE_BACK_RANGES <= 255, "Write-back range count must be between 1 and 255");
+#endif // WEAR_LEVELING_WRITE_BACK
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
@@ -0,0 +1,16 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "trace_replay.hpp"
+
+class AutocorrectBench : public TraceReplayFixture {};
+
+TEST_F(AutocorrectBench, default_dictionary) {
+    set_qwerty_keymap();
+
+    const auto stats = replay(bench_trace());
+    report(stats);
+    EXPECT_GT(stats.keyboard_reports, 0);
+}
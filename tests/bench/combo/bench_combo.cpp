@@ -0,0 +1,16 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "trace_replay.hpp"
+
+class ComboBench : public TraceReplayFixture {};
+
+TEST_F(ComboBench, adjacent_key_combos) {
+    set_qwerty_keymap();
+
+    const auto stats = replay(bench_trace());
+    report(stats);
+    EXPECT_GT(stats.keyboard_reports, 0);
+}
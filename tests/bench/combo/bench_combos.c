@@ -0,0 +1,41 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+// Combos on adjacent keys, as commonly used on small layouts. Fast rolls
+// across these pairs hit the combo term while typing ordinary text.
+uint16_t const we_combo[]   = {KC_W, KC_E, COMBO_END};
+uint16_t const er_combo[]   = {KC_E, KC_R, COMBO_END};
+uint16_t const ui_combo[]   = {KC_U, KC_I, COMBO_END};
+uint16_t const io_combo[]   = {KC_I, KC_O, COMBO_END};
+uint16_t const sd_combo[]   = {KC_S, KC_D, COMBO_END};
+uint16_t const df_combo[]   = {KC_D, KC_F, COMBO_END};
+uint16_t const jk_combo[]   = {KC_J, KC_K, COMBO_END};
+uint16_t const kl_combo[]   = {KC_K, KC_L, COMBO_END};
+uint16_t const xc_combo[]   = {KC_X, KC_C, COMBO_END};
+uint16_t const cv_combo[]   = {KC_C, KC_V, COMBO_END};
+uint16_t const mc_combo[]   = {KC_M, KC_COMM, COMBO_END};
+uint16_t const cd_combo[]   = {KC_COMM, KC_DOT, COMBO_END};
+uint16_t const sdf_combo[]  = {KC_S, KC_D, KC_F, COMBO_END};
+uint16_t const jkl_combo[]  = {KC_J, KC_K, KC_L, COMBO_END};
+uint16_t const qwer_combo[] = {KC_Q, KC_W, KC_E, KC_R, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(we_combo, KC_ESCAPE),
+    COMBO(er_combo, KC_TAB),
+    COMBO(ui_combo, KC_LEFT_BRACKET),
+    COMBO(io_combo, KC_RIGHT_BRACKET),
+    COMBO(sd_combo, KC_BACKSPACE),
+    COMBO(df_combo, KC_ENTER),
+    COMBO(jk_combo, KC_ESCAPE),
+    COMBO(kl_combo, KC_DELETE),
+    COMBO(xc_combo, LCTL(KC_C)),
+    COMBO(cv_combo, LCTL(KC_V)),
+    COMBO(mc_combo, KC_MINUS),
+    COMBO(cd_combo, KC_EQUAL),
+    COMBO(sdf_combo, KC_CAPS_LOCK),
+    COMBO(jkl_combo, KC_INSERT),
+    COMBO(qwer_combo, QK_BOOT),
+};
+// clang-format on
@@ -0,0 +1,45 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+#include "compiler_support.h"
+
+#ifndef BENCH_COMBO_COUNT
+#    define BENCH_COMBO_COUNT 420
+#endif
+#define BENCH_COMBO_KEYCODES 30
+
+// The letter block of the benchmark keymap
+static const uint16_t bench_combo_keycodes[BENCH_COMBO_KEYCODES] = {
+    KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I,    KC_O,   KC_P,    //
+    KC_A, KC_S, KC_D, KC_F, KC_G, KC_H, KC_J, KC_K,    KC_L,   KC_SCLN, //
+    KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_SLSH, //
+};
+
+static uint16_t bench_combo_keys[BENCH_COMBO_COUNT][4];
+
+combo_t key_combos[BENCH_COMBO_COUNT];
+
+/* Generates three key combos over the letter block, as found on keymaps that
+ * use combos in place of a symbol layer: combo n contains the keys at a, a + s
+ * and a + 2s + d (modulo 30), with a = n % 30, s = 1 + (n / 30) % 14 and
+ * d = n / 420. The first 420 combos put every key in 42 combos, up to 1230
+ * combos the three keys stay distinct. */
+STATIC_ASSERT(BENCH_COMBO_COUNT <= 1230, "Too many combos for the letter block");
+
+void bench_combos_generate(void) {
+    for (uint16_t n = 0; n < BENCH_COMBO_COUNT; n++) {
+        uint16_t a = n % BENCH_COMBO_KEYCODES;
+        uint16_t s = 1 + (n / BENCH_COMBO_KEYCODES) % 14;
+        uint16_t d = n / (BENCH_COMBO_KEYCODES * 14);
+
+        bench_combo_keys[n][0] = bench_combo_keycodes[a];
+        bench_combo_keys[n][1] = bench_combo_keycodes[(a + s) % BENCH_COMBO_KEYCODES];
+        bench_combo_keys[n][2] = bench_combo_keycodes[(a + 2 * s + d) % BENCH_COMBO_KEYCODES];
+        bench_combo_keys[n][3] = COMBO_END;
+
+        key_combos[n] = (combo_t)COMBO(bench_combo_keys[n], KC_F1 + n % 12);
+    }
+#ifdef COMBO_KEYCODE_INDEX
+    combo_index_invalidate();
+#endif
+}
@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "trace_replay.hpp"
+
+extern "C" {
+void bench_combos_generate(void);
+}
+
+class ManyCombosBench : public TraceReplayFixture {};
+
+TEST_F(ManyCombosBench, three_key_combos) {
+    set_qwerty_keymap();
+    bench_combos_generate();
+
+#ifdef COMBO_KEYCODE_INDEX
+    // A table too small for the combos would quietly benchmark the full scan instead
+    ASSERT_FALSE(combo_index_overflowed());
+#endif
+
+    const auto stats = replay(bench_trace());
+    report(stats);
+    EXPECT_GT(stats.keyboard_reports, 0);
+}
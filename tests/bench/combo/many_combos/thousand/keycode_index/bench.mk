@@ -0,0 +1,12 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# ------------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains a benchmark
+# ------------------------------------------------------------------------------------
+
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = ../../bench_combos.c
+
+SRC += tests/bench/combo/many_combos/bench_many_combos.cpp
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../config.h"
+
+#define COMBO_KEYCODE_INDEX
+#define COMBO_KEYCODE_INDEX_LENGTH 3000
+#define COMBO_KEYCODE_INDEX_MAX_COMBOS 1000
@@ -0,0 +1,35 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+// Overrides of the kind found in many keymaps, most of them triggered by
+// Shift, which the typed text holds for every capital.
+const key_override_t shift_bspc_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t shift_comm_override = ko_make_basic(MOD_MASK_SHIFT, KC_COMM, KC_SCLN);
+const key_override_t shift_dot_override  = ko_make_basic(MOD_MASK_SHIFT, KC_DOT, KC_COLN);
+const key_override_t shift_quot_override = ko_make_basic(MOD_MASK_SHIFT, KC_QUOT, KC_GRV);
+const key_override_t shift_mins_override = ko_make_basic(MOD_MASK_SHIFT, KC_MINS, KC_EQL);
+const key_override_t shift_slsh_override = ko_make_basic(MOD_MASK_SHIFT, KC_SLSH, KC_BSLS);
+const key_override_t shift_esc_override  = ko_make_basic(MOD_MASK_SHIFT, KC_ESC, KC_TILD);
+const key_override_t ctrl_h_override     = ko_make_basic(MOD_MASK_CTRL, KC_H, KC_LEFT);
+const key_override_t ctrl_j_override     = ko_make_basic(MOD_MASK_CTRL, KC_J, KC_DOWN);
+const key_override_t ctrl_k_override     = ko_make_basic(MOD_MASK_CTRL, KC_K, KC_UP);
+const key_override_t ctrl_l_override     = ko_make_basic(MOD_MASK_CTRL, KC_L, KC_RIGHT);
+const key_override_t gui_override        = ko_make_basic(MOD_MASK_GUI, KC_NO, KC_ESC);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &shift_bspc_override,
+    &shift_comm_override,
+    &shift_dot_override,
+    &shift_quot_override,
+    &shift_mins_override,
+    &shift_slsh_override,
+    &shift_esc_override,
+    &ctrl_h_override,
+    &ctrl_j_override,
+    &ctrl_k_override,
+    &ctrl_l_override,
+    &gui_override,
+};
+// clang-format on
@@ -0,0 +1,62 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "../../rgb_matrix/rgb_matrix_leds.h"
+
+void advance_time(uint32_t ms);
+}
+
+static const char *effect_names[] = {
+    "NONE",
+#define RGB_MATRIX_EFFECT(name, ...) #name,
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+class RgbMatrixBenchmark : public TestFixture {
+   protected:
+    /* Drives rgb_matrix_task() until the next flush, so each frame is a full render pass over every LED. */
+    void render_frame() {
+        uint32_t flushes = rgb_matrix_leds_flush_count();
+        while (rgb_matrix_leds_flush_count() == flushes) {
+            rgb_matrix_task();
+        }
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+    }
+};
+
+TEST_F(RgbMatrixBenchmark, RenderPass) {
+    const int frames = 2000;
+
+    rgb_matrix_enable_noeeprom();
+
+    for (uint8_t mode = RGB_MATRIX_NONE + 1; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        rgb_matrix_mode_noeeprom(mode);
+        render_frame();
+
+        /* Give the reactive effects a few recent hits to draw. */
+        for (uint8_t col = 0; col < 6; col++) {
+            rgb_matrix_handle_key_event(col % MATRIX_ROWS, col, true);
+            rgb_matrix_handle_key_event(col % MATRIX_ROWS, col, false);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            render_frame();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << "[ RENDER   ] " << RGB_MATRIX_LED_COUNT << " LEDs " << effect_names[mode] << ": " << elapsed.count() / frames << " ns/frame" << std::endl;
+        RecordProperty(std::string(effect_names[mode]) + "_ns_per_frame", std::to_string(elapsed.count() / frames));
+    }
+
+    EXPECT_EQ(rgb_matrix_get_mode(), RGB_MATRIX_EFFECT_MAX - 1);
+}
@@ -0,0 +1,12 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# ------------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains a benchmark
+# ------------------------------------------------------------------------------------
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+SRC += tests/rgb_matrix/rgb_matrix_leds.c
+SRC += tests/bench/rgb_matrix/bench_rgb_matrix.cpp
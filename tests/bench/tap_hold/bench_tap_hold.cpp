@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "trace_replay.hpp"
+
+class TapHoldBench : public TraceReplayFixture {};
+
+TEST_F(TapHoldBench, home_row_mods) {
+    set_qwerty_keymap({
+        KeymapKey(0, 0, 1, LGUI_T(KC_A)),
+        KeymapKey(0, 1, 1, LALT_T(KC_S)),
+        KeymapKey(0, 2, 1, LSFT_T(KC_D)),
+        KeymapKey(0, 3, 1, LCTL_T(KC_F)),
+        KeymapKey(0, 6, 1, RCTL_T(KC_J)),
+        KeymapKey(0, 7, 1, RSFT_T(KC_K)),
+        KeymapKey(0, 8, 1, LALT_T(KC_L)),
+        KeymapKey(0, 9, 1, RGUI_T(KC_SCLN)),
+    });
+
+    const auto stats = replay(bench_trace());
+    report(stats);
+    EXPECT_GT(stats.keyboard_reports, 0);
+}
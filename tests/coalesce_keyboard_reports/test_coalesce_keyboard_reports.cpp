@@ -0,0 +1,233 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+enum {
+    MACRO_ABC = QK_USER_0,
+    MACRO_SHIFTED,
+    MACRO_TAP,
+    MACRO_BARRIER,
+};
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+    switch (keycode) {
+        case MACRO_ABC:
+            if (record->event.pressed) {
+                register_code(KC_A);
+                register_code(KC_B);
+                register_code(KC_C);
+            } else {
+                unregister_code(KC_A);
+                unregister_code(KC_B);
+                unregister_code(KC_C);
+            }
+            return false;
+        case MACRO_SHIFTED:
+            if (record->event.pressed) {
+                register_code(KC_LSFT);
+                register_code(KC_A);
+                unregister_code(KC_A);
+                unregister_code(KC_LSFT);
+            }
+            return false;
+        case MACRO_TAP:
+            if (record->event.pressed) {
+                tap_code(KC_A);
+                tap_code(KC_A);
+            }
+            return false;
+        case MACRO_BARRIER:
+            if (record->event.pressed) {
+                register_code(KC_A);
+                flush_keyboard_report();
+                register_code(KC_B);
+            } else {
+                unregister_code(KC_A);
+                unregister_code(KC_B);
+            }
+            return false;
+    }
+    return true;
+}
+
+class CoalesceKeyboardReports : public TestFixture {};
+
+TEST_F(CoalesceKeyboardReports, MacroChangingSeveralKeysSendsOneReport) {
+    TestDriver driver;
+    KeymapKey  key_macro = KeymapKey(0, 0, 0, MACRO_ABC);
+    set_keymap({key_macro});
+
+    // Without coalescing, each register_code would send its own report
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C)).Times(1);
+    key_macro.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    key_macro.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(CoalesceKeyboardReports, KeysPressedInSameScanSendOneReport) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  key_b = KeymapKey(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_A, KC_B)).Times(1);
+    key_a.press();
+    key_b.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    key_a.release();
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(CoalesceKeyboardReports, ReleaseWithinScanStillReportsPress) {
+    TestDriver driver;
+    KeymapKey  key_macro = KeymapKey(0, 0, 0, MACRO_SHIFTED);
+    set_keymap({key_macro});
+
+    // The modifier and key are coalesced, but releasing the key before it was sent forces a report first
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    key_macro.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    key_macro.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(CoalesceKeyboardReports, RepeatedTapCodeSendsEachPressAndRelease) {
+    TestDriver driver;
+    KeymapKey  key_macro = KeymapKey(0, 0, 0, MACRO_TAP);
+    set_keymap({key_macro});
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    key_macro.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    key_macro.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(CoalesceKeyboardReports, FlushSendsIntermediateState) {
+    TestDriver driver;
+    KeymapKey  key_macro = KeymapKey(0, 0, 0, MACRO_BARRIER);
+    set_keymap({key_macro});
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_REPORT(driver, (KC_A, KC_B));
+    }
+    key_macro.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    key_macro.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(CoalesceKeyboardReports, NothingSentWithoutChanges) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A)).Times(1);
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(CoalesceKeyboardReports, ModifierIsSentBeforeMouseButton) {
+    TestDriver driver;
+    KeymapKey  key_shift = KeymapKey(0, 0, 0, KC_LSFT);
+    KeymapKey  key_btn1  = KeymapKey(0, 1, 0, MS_BTN1);
+    set_keymap({key_shift, key_btn1});
+
+    // Shift+click must reach the host with shift already held
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    }
+    key_shift.press();
+    key_btn1.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_EMPTY_MOUSE_REPORT(driver);
+    }
+    key_shift.release();
+    key_btn1.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(CoalesceKeyboardReports, ModifierIsSentBeforeConsumerKey) {
+    TestDriver driver;
+    KeymapKey  key_shift = KeymapKey(0, 0, 0, KC_LSFT);
+    KeymapKey  key_volu  = KeymapKey(0, 1, 0, KC_AUDIO_VOL_UP);
+    set_keymap({key_shift, key_volu});
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_CALL(driver, send_extra_mock(_));
+    }
+    key_shift.press();
+    key_volu.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_CALL(driver, send_extra_mock(_));
+    }
+    key_shift.release();
+    key_volu.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
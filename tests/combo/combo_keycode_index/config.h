@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+
+#define COMBO_KEYCODE_INDEX
+#define COMBO_KEYCODE_INDEX_MAX_KEYCODES 96
+#define COMBO_KEYCODE_INDEX_LENGTH 3000
+#define COMBO_KEYCODE_INDEX_MAX_COMBOS 1000
@@ -0,0 +1,163 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+extern "C" {
+extern int16_t test_combo_last_event;
+extern combo_t key_combos[];
+void           test_combos_generate(void);
+combo_t*       overlaps(uint16_t combo_index1, uint16_t combo_index2);
+}
+
+class ComboKeycodeIndex : public TestFixture {
+   public:
+    void SetUp() override {
+        test_combos_generate();
+        test_combo_last_event = -1;
+
+        /* Map KC_A and the following 39 keycodes onto the 4x10 test matrix. */
+        for (uint8_t i = 0; i < MATRIX_ROWS * MATRIX_COLS; i++) {
+            add_key(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, KC_A + i));
+        }
+    }
+
+    KeymapKey key_for(uint16_t keycode) {
+        uint8_t i = keycode - KC_A;
+        return KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, keycode);
+    }
+};
+
+TEST_F(ComboKeycodeIndex, first_combo_fires) {
+    TestDriver driver;
+
+    ASSERT_FALSE(combo_index_overflowed());
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key_for(KC_A), key_for(KC_B), key_for(KC_C)});
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(test_combo_last_event, 0);
+}
+
+TEST_F(ComboKeycodeIndex, later_combo_fires) {
+    TestDriver driver;
+
+    /* Combo 130: a = 130 % 64 = 2, s = 1 + 130 / 64 = 3 -> KC_C, KC_F and KC_I. */
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key_for(KC_I), key_for(KC_C), key_for(KC_F)});
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(test_combo_last_event, 130);
+}
+
+TEST_F(ComboKeycodeIndex, overlapping_combos_drop_buffered_combo) {
+    TestDriver driver;
+    KeymapKey  key_a = key_for(KC_A);
+    KeymapKey  key_b = key_for(KC_B);
+    KeymapKey  key_c = key_for(KC_C);
+    KeymapKey  key_d = key_for(KC_D);
+
+    /* Combo 0 (A, B, C) is completed first, then combo 1 (B, C, D) which
+     * shares two keys with it. Both have the same amount of keys, so the
+     * buffered combo 0 is dropped and A is sent as a regular key. */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    key_b.press();
+    run_one_scan_loop();
+    key_c.press();
+    run_one_scan_loop();
+    key_d.press();
+    run_one_scan_loop();
+    idle_for(COMBO_TERM + 1);
+    key_a.release();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    key_c.release();
+    run_one_scan_loop();
+    key_d.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(test_combo_last_event, 1);
+}
+
+TEST_F(ComboKeycodeIndex, overlap_counts_repeated_keys) {
+    TestDriver     driver;
+    const uint16_t keys1[] = {KC_A, KC_A, KC_B, COMBO_END};
+    const uint16_t keys2[] = {KC_B, KC_C, COMBO_END};
+    key_combos[998]        = (combo_t)COMBO_ACTION(keys1);
+    key_combos[999]        = (combo_t)COMBO_ACTION(keys2);
+    combo_index_invalidate();
+
+    /* Rebuild the index. */
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(key_for(KC_Z));
+    VERIFY_AND_CLEAR(driver);
+
+    /* Combo 998 lists three keys, even if only two of them are distinct. */
+    EXPECT_EQ(overlaps(998, 999), &key_combos[999]);
+    EXPECT_EQ(overlaps(999, 998), &key_combos[999]);
+}
+
+TEST_F(ComboKeycodeIndex, overflow_is_reported) {
+    /* More distinct keycodes than COMBO_KEYCODE_INDEX_MAX_KEYCODES. */
+    static uint16_t keys[COMBO_KEYCODE_INDEX_MAX_KEYCODES][2];
+    for (uint16_t i = 0; i < COMBO_KEYCODE_INDEX_MAX_KEYCODES; i++) {
+        keys[i][0]          = QK_USER_0 + i;
+        keys[i][1]          = COMBO_END;
+        key_combos[900 + i] = (combo_t)COMBO_ACTION(keys[i]);
+    }
+    combo_index_invalidate();
+    EXPECT_TRUE(combo_index_overflowed());
+
+    test_combos_generate();
+    EXPECT_FALSE(combo_index_overflowed());
+}
+
+TEST_F(ComboKeycodeIndex, overlap_past_mask_width) {
+    /* Sorts after the 64 keycodes of the generated combos, at position 64. */
+    const uint16_t wide_keys[] = {KC_F13, KC_F14, COMBO_END};
+    key_combos[999]            = (combo_t)COMBO_ACTION(wide_keys);
+    combo_index_invalidate();
+
+    const uint16_t keys1[] = {KC_F13, KC_A, COMBO_END};
+    const uint16_t keys2[] = {KC_F13, KC_B, KC_C, COMBO_END};
+    const uint16_t keys3[] = {KC_B, KC_C, COMBO_END};
+    key_combos[996]        = (combo_t)COMBO_ACTION(keys1);
+    key_combos[997]        = (combo_t)COMBO_ACTION(keys2);
+    key_combos[998]        = (combo_t)COMBO_ACTION(keys3);
+
+    EXPECT_EQ(overlaps(996, 997), &key_combos[996]);
+    EXPECT_EQ(overlaps(997, 996), &key_combos[996]);
+    EXPECT_EQ(overlaps(996, 998), nullptr);
+    EXPECT_EQ(overlaps(997, 998), &key_combos[998]);
+}
+
+TEST_F(ComboKeycodeIndex, non_combo_keys_are_passed_through) {
+    TestDriver driver;
+    KeymapKey  key_a = key_for(KC_A);
+    KeymapKey  key_c = key_for(KC_C);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_C));
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    key_c.press();
+    run_one_scan_loop();
+    key_a.release();
+    run_one_scan_loop();
+    key_c.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(test_combo_last_event, -1);
+}
@@ -0,0 +1,36 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+#define TEST_COMBO_COUNT 1000
+#define TEST_COMBO_KEYCODES 64
+
+static uint16_t test_combo_keys[TEST_COMBO_COUNT][4];
+
+combo_t key_combos[TEST_COMBO_COUNT];
+
+int16_t test_combo_last_event = -1;
+
+/* Generates three key combos over a pool of 64 keycodes starting at KC_A:
+ * combo n contains the keycodes at a, a + s and a + 2s (modulo 64), with
+ * a = n % 64 and s = 1 + n / 64. Every keycode ends up in ~47 combos. */
+void test_combos_generate(void) {
+    for (uint16_t n = 0; n < TEST_COMBO_COUNT; n++) {
+        uint16_t a = n % TEST_COMBO_KEYCODES;
+        uint16_t s = 1 + n / TEST_COMBO_KEYCODES;
+
+        test_combo_keys[n][0] = KC_A + a;
+        test_combo_keys[n][1] = KC_A + (a + s) % TEST_COMBO_KEYCODES;
+        test_combo_keys[n][2] = KC_A + (a + 2 * s) % TEST_COMBO_KEYCODES;
+        test_combo_keys[n][3] = COMBO_END;
+
+        key_combos[n] = (combo_t)COMBO_ACTION(test_combo_keys[n]);
+    }
+    combo_index_invalidate();
+}
+
+void process_combo_event(uint16_t combo_index, bool pressed) {
+    if (pressed) {
+        test_combo_last_event = combo_index;
+    }
+}
@@ -0,0 +1,223 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+struct fired_t {
+    uintptr_t id;
+    uint32_t  trigger_time;
+    uint32_t  now;
+};
+
+static std::vector<fired_t> fired;
+static uint32_t             repeat_delay = 0;
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    fired.push_back({(uintptr_t)cb_arg, trigger_time, timer_read32()});
+    return repeat_delay;
+}
+
+class DeferredExec : public TestFixture {
+   public:
+    deferred_executor_t table[8]       = {};
+    uint32_t            last_execution = 0;
+
+    void SetUp() override {
+        fired.clear();
+        repeat_delay   = 0;
+        last_execution = timer_read32();
+    }
+
+    deferred_token defer(uint32_t delay_ms, uintptr_t id) {
+        return defer_exec_advanced(table, 8, delay_ms, record_callback, (void *)id);
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, 8, &last_execution);
+        }
+    }
+};
+
+TEST_F(DeferredExec, runs_callbacks_in_trigger_order) {
+    uint32_t start = timer_read32();
+    defer(30, 1);
+    defer(10, 2);
+    defer(20, 3);
+
+    run_for(40);
+    ASSERT_EQ(fired.size(), 3);
+    EXPECT_EQ(fired[0].id, 2);
+    EXPECT_EQ(fired[0].now, start + 10);
+    EXPECT_EQ(fired[1].id, 3);
+    EXPECT_EQ(fired[1].now, start + 20);
+    EXPECT_EQ(fired[2].id, 1);
+    EXPECT_EQ(fired[2].now, start + 30);
+}
+
+TEST_F(DeferredExec, repeating_callback_keeps_its_period) {
+    uint32_t start = timer_read32();
+    repeat_delay   = 10;
+    defer(10, 1);
+
+    run_for(35);
+    ASSERT_EQ(fired.size(), 3);
+    for (size_t i = 0; i < fired.size(); i++) {
+        EXPECT_EQ(fired[i].trigger_time, start + 10 * (i + 1));
+    }
+}
+
+TEST_F(DeferredExec, late_repeating_callback_runs_once_per_tick) {
+    uint32_t start = timer_read32();
+    repeat_delay   = 1;
+    defer(1, 1);
+    defer(3, 2);
+
+    // Requeued into the past, the first executor still only runs once per tick
+    advance_time(10);
+    deferred_exec_advanced_task(table, 8, &last_execution);
+    ASSERT_EQ(fired.size(), 2);
+    EXPECT_EQ(fired[0].id, 1);
+    EXPECT_EQ(fired[0].trigger_time, start + 1);
+    EXPECT_EQ(fired[1].id, 2);
+    EXPECT_EQ(fired[1].trigger_time, start + 3);
+
+    // Each following tick catches up by one period
+    run_for(1);
+    ASSERT_EQ(fired.size(), 4);
+    EXPECT_EQ(fired[2].id, 1);
+    EXPECT_EQ(fired[2].trigger_time, start + 2);
+    EXPECT_EQ(fired[3].id, 2);
+    EXPECT_EQ(fired[3].trigger_time, start + 4);
+}
+
+TEST_F(DeferredExec, cancel_and_extend_by_token) {
+    uint32_t       start  = timer_read32();
+    deferred_token first  = defer(10, 1);
+    deferred_token second = defer(20, 2);
+    defer(30, 3);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 8, second));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 8, second));
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, 8, first, 40));
+
+    run_for(50);
+    ASSERT_EQ(fired.size(), 2);
+    EXPECT_EQ(fired[0].id, 3);
+    EXPECT_EQ(fired[1].id, 1);
+    EXPECT_EQ(fired[1].now, start + 40);
+}
+
+TEST_F(DeferredExec, full_table_rejects_and_frees_slots) {
+    std::vector<deferred_token> tokens;
+    for (uintptr_t i = 0; i < 8; i++) {
+        tokens.push_back(defer(100 + i, i));
+        EXPECT_NE(tokens.back(), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer(5, 99), INVALID_DEFERRED_TOKEN);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 8, tokens[3]));
+    deferred_token reused = defer(5, 99);
+    EXPECT_NE(reused, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(reused, tokens[3]);
+    // The cancelled token must not reach the executor now occupying its slot
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, 8, tokens[3], 50));
+
+    run_for(10);
+    ASSERT_EQ(fired.size(), 1);
+    EXPECT_EQ(fired[0].id, 99);
+}
+
+static deferred_executor_t *self_table;
+static deferred_token       other_token;
+
+static uint32_t cancel_other_callback(uint32_t trigger_time, void *cb_arg) {
+    cancel_deferred_exec_advanced(self_table, 8, other_token);
+    return record_callback(trigger_time, cb_arg);
+}
+
+TEST_F(DeferredExec, callback_can_cancel_another_executor) {
+    self_table = table;
+    defer_exec_advanced(table, 8, 10, cancel_other_callback, (void *)1);
+    other_token = defer(10, 2);
+    defer(15, 3);
+
+    run_for(20);
+    ASSERT_EQ(fired.size(), 2);
+    EXPECT_EQ(fired[0].id, 1);
+    EXPECT_EQ(fired[1].id, 3);
+}
+
+TEST_F(DeferredExec, time_until_next) {
+    EXPECT_EQ(deferred_exec_time_until_next_advanced(table, 8), UINT32_MAX);
+
+    defer(50, 1);
+    defer(20, 2);
+    EXPECT_EQ(deferred_exec_time_until_next_advanced(table, 8), 20);
+
+    advance_time(15);
+    EXPECT_EQ(deferred_exec_time_until_next_advanced(table, 8), 5);
+
+    advance_time(10);
+    EXPECT_EQ(deferred_exec_time_until_next_advanced(table, 8), 0);
+}
+
+TEST_F(DeferredExec, basic_api_time_until_next) {
+    EXPECT_EQ(deferred_exec_time_until_next(), UINT32_MAX);
+
+    deferred_token token = defer_exec(30, record_callback, NULL);
+    EXPECT_EQ(deferred_exec_time_until_next(), 30);
+    EXPECT_TRUE(cancel_deferred_exec(token));
+    EXPECT_EQ(deferred_exec_time_until_next(), UINT32_MAX);
+}
+
+TEST_F(DeferredExec, random_operations_fire_on_time) {
+    std::map<deferred_token, uint32_t> expected; // token -> trigger time
+    std::map<uintptr_t, deferred_token> ids;
+    srand(1234);
+
+    for (uintptr_t id = 1; id < 2000; id++) {
+        int op = rand() % 4;
+        if (op < 2 && expected.size() < 8) {
+            uint32_t       delay = 1 + rand() % 50;
+            deferred_token token = defer(delay, id);
+            ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+            ASSERT_EQ(expected.count(token), 0);
+            expected[token] = timer_read32() + delay;
+            ids[id]         = token;
+        } else if (op == 2 && !expected.empty()) {
+            auto it = std::next(expected.begin(), rand() % expected.size());
+            ASSERT_TRUE(cancel_deferred_exec_advanced(table, 8, it->first));
+            expected.erase(it);
+        } else if (op == 3 && !expected.empty()) {
+            auto     it    = std::next(expected.begin(), rand() % expected.size());
+            uint32_t delay = 1 + rand() % 50;
+            ASSERT_TRUE(extend_deferred_exec_advanced(table, 8, it->first, delay));
+            it->second = timer_read32() + delay;
+        }
+
+        fired.clear();
+        run_for(1 + rand() % 5);
+        for (const fired_t &f : fired) {
+            deferred_token token = ids[f.id];
+            ASSERT_EQ(expected.count(token), 1) << "id " << f.id;
+            EXPECT_EQ(f.now, expected[token]) << "id " << f.id;
+            expected.erase(token);
+        }
+        for (const auto &pending : expected) {
+            ASSERT_GT((int32_t)(pending.second - timer_read32()), 0) << "token " << +pending.first << " is overdue";
+        }
+    }
+}
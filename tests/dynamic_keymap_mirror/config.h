@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TRANSIENT_EEPROM_SIZE 1024
+// Past eeconfig, fixed so the tests can read the keymap from EEPROM
+#define DYNAMIC_KEYMAP_EEPROM_ADDR 256
+#define DYNAMIC_KEYMAP_RAM_MIRROR
+#define DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_SIZE 16
+#define DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY 100
@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+DYNAMIC_KEYMAP_ENABLE = yes
+EEPROM_DRIVER = transient
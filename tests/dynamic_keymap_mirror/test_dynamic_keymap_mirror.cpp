@@ -0,0 +1,139 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+#include "eeprom_driver.h"
+}
+
+using testing::_;
+
+#define KEYMAP_EEPROM_ADDR (DYNAMIC_KEYMAP_EEPROM_ADDR)
+#define KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+
+class DynamicKeymapMirror : public TestFixture {
+   public:
+    void SetUp() override {
+        dynamic_keymap_reset();
+    }
+
+    uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+        uintptr_t address = KEYMAP_EEPROM_ADDR + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+        return (eeprom_read_byte((const uint8_t *)address) << 8) | eeprom_read_byte((const uint8_t *)(address + 1));
+    }
+
+    void expect_eeprom_matches_mirror() {
+        uint8_t mirror[KEYMAP_SIZE];
+        uint8_t eeprom[KEYMAP_SIZE];
+        dynamic_keymap_get_buffer(0, KEYMAP_SIZE, mirror);
+        eeprom_read_block(eeprom, (const void *)KEYMAP_EEPROM_ADDR, KEYMAP_SIZE);
+        EXPECT_EQ(memcmp(mirror, eeprom, KEYMAP_SIZE), 0);
+    }
+};
+
+TEST_F(DynamicKeymapMirror, set_keycode_is_written_back_on_flush) {
+    dynamic_keymap_set_keycode(1, 2, 3, KC_B);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), KC_B);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_TRNS);
+
+    dynamic_keymap_flush();
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_B);
+    expect_eeprom_matches_mirror();
+}
+
+TEST_F(DynamicKeymapMirror, set_keycode_is_written_back_when_idle) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_set_keycode(0, 0, 0, LCTL(KC_Z));
+
+    idle_for(DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY - 1);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_NO);
+
+    /* Each change restarts the delay. */
+    dynamic_keymap_set_keycode(0, 3, 9, KC_ESC);
+    idle_for(DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY - 1);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_NO);
+
+    idle_for(2);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), LCTL(KC_Z));
+    EXPECT_EQ(eeprom_keycode(0, 3, 9), KC_ESC);
+    expect_eeprom_matches_mirror();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMirror, set_buffer_across_blocks) {
+    /* Straddles the first and second write back block. */
+    const uint16_t offset                                    = DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_SIZE - 2;
+    uint8_t        data[DYNAMIC_KEYMAP_RAM_MIRROR_BLOCK_SIZE] = {0};
+    for (uint8_t i = 0; i < sizeof(data); i += 2) {
+        data[i + 1] = KC_A + i / 2;
+    }
+    dynamic_keymap_set_buffer(offset, sizeof(data), data);
+
+    for (uint8_t i = 0; i < sizeof(data) / 2; i++) {
+        uint8_t key = offset / 2 + i;
+        EXPECT_EQ(dynamic_keymap_get_keycode(0, key / MATRIX_COLS, key % MATRIX_COLS), KC_A + i);
+        EXPECT_EQ(eeprom_keycode(0, key / MATRIX_COLS, key % MATRIX_COLS), KC_NO);
+    }
+
+    uint8_t read[sizeof(data)];
+    dynamic_keymap_get_buffer(offset, sizeof(read), read);
+    EXPECT_EQ(memcmp(read, data, sizeof(data)), 0);
+
+    dynamic_keymap_flush();
+    expect_eeprom_matches_mirror();
+}
+
+TEST_F(DynamicKeymapMirror, set_buffer_stops_at_keymap_end) {
+    uint8_t data[4] = {0x00, KC_X, 0x00, KC_Y};
+    dynamic_keymap_set_buffer(KEYMAP_SIZE - 2, sizeof(data), data);
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1), KC_X);
+
+    uint8_t read[4];
+    dynamic_keymap_get_buffer(KEYMAP_SIZE - 2, sizeof(read), read);
+    EXPECT_EQ(read[1], KC_X);
+    EXPECT_EQ(read[2], 0);
+    EXPECT_EQ(read[3], 0);
+
+    dynamic_keymap_flush();
+    expect_eeprom_matches_mirror();
+}
+
+TEST_F(DynamicKeymapMirror, reset_restores_defaults_in_mirror_and_eeprom) {
+    dynamic_keymap_set_keycode(0, 1, 1, KC_C);
+    dynamic_keymap_flush();
+    dynamic_keymap_set_keycode(1, 1, 1, KC_D);
+
+    dynamic_keymap_reset();
+
+    /* Persisted without waiting for the flush delay. */
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 1), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 1, 1), KC_TRNS);
+    EXPECT_EQ(eeprom_keycode(0, 1, 1), KC_NO);
+    EXPECT_EQ(eeprom_keycode(1, 1, 1), KC_TRNS);
+    expect_eeprom_matches_mirror();
+}
+
+TEST_F(DynamicKeymapMirror, reset_reloads_erased_eeprom) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_set_keycode(0, 2, 2, KC_E);
+
+    /* As done by eeconfig_init() with drivers that need erasing. */
+    eeprom_driver_erase();
+    dynamic_keymap_reset();
+
+    /* The mirror no longer matched EEPROM, so every key has to be rewritten. */
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 2, 2), KC_NO);
+    EXPECT_EQ(eeprom_keycode(1, 0, 0), KC_TRNS);
+    idle_for(DYNAMIC_KEYMAP_RAM_MIRROR_FLUSH_DELAY + 1);
+    EXPECT_EQ(eeprom_keycode(0, 2, 2), KC_NO);
+    expect_eeprom_matches_mirror();
+    VERIFY_AND_CLEAR(driver);
+}
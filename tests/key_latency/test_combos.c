@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+uint16_t const escape_combo[] = {KC_Y, KC_U, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(escape_combo, KC_ESCAPE),
+};
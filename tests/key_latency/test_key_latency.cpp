@@ -0,0 +1,203 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "key_latency.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+class KeyLatency : public TestFixture {
+   public:
+    void SetUp() override {
+        key_latency_reset();
+    }
+
+    key_latency_summary_t summary() {
+        key_latency_summary_t summary;
+        key_latency_get(&summary);
+        return summary;
+    }
+};
+
+TEST_F(KeyLatency, tap_is_reported_in_the_same_scan) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(summary().count, 2);
+    EXPECT_EQ(summary().max, 0);
+    EXPECT_EQ(key_latency_get_bucket(0), 2);
+}
+
+TEST_F(KeyLatency, counts_time_before_the_edge_is_scanned) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    advance_time(5);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(summary().count, 1);
+    EXPECT_EQ(summary().min, 5);
+    EXPECT_EQ(key_latency_get_bucket(5), 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyLatency, mod_tap_tap_waits_for_release) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, LSFT_T(KC_A));
+
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    idle_for(50);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The press waited for the release, the release itself did not wait. */
+    EXPECT_EQ(summary().count, 2);
+    EXPECT_EQ(summary().min, 0);
+    EXPECT_EQ(summary().max, 50);
+}
+
+TEST_F(KeyLatency, release_of_repeated_tap_uses_interrupting_edge) {
+    TestDriver driver;
+    auto       first  = KeymapKey(0, 0, 0, LSFT_T(KC_A));
+    auto       second = KeymapKey(0, 1, 1, LCTL_T(KC_B));
+
+    set_keymap({first, second});
+
+    /* Far enough from time 0 that a missing edge time stands out. */
+    idle_for(1000);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(first);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    first.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    key_latency_reset();
+
+    /* Another tap key releases the repeated tap on its behalf. */
+    EXPECT_EMPTY_REPORT(driver);
+    second.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(summary().count, 1);
+    EXPECT_EQ(summary().max, 0);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    first.release();
+    run_one_scan_loop();
+    second.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyLatency, mod_tap_hold_waits_for_tapping_term) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, LSFT_T(KC_A));
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key.press();
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(summary().count, 1);
+    EXPECT_GE(summary().max, TAPPING_TERM);
+    EXPECT_LE(summary().max, TAPPING_TERM + 1);
+    /* Beyond the histogram, so counted in the last bucket. */
+    EXPECT_EQ(key_latency_get_bucket(KEY_LATENCY_BUCKETS - 1), 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyLatency, combo_is_measured_from_its_first_key) {
+    TestDriver driver;
+    auto       key_y = KeymapKey(0, 0, 0, KC_Y);
+    auto       key_u = KeymapKey(0, 1, 0, KC_U);
+
+    set_keymap({key_y, key_u});
+
+    EXPECT_NO_REPORT(driver);
+    key_y.press();
+    idle_for(10);
+    key_u.press();
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The combo fires once the combo term after the last key expires, but
+     * its latency includes the wait for the second key. */
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    idle_for(COMBO_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(summary().count, 1);
+    EXPECT_EQ(summary().max, 10 + COMBO_TERM + 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_y.release();
+    key_u.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyLatency, serializes_summary_and_histogram) {
+    key_latency_record(3);
+    key_latency_record(3);
+    key_latency_record(7);
+
+    uint8_t data[32] = {0};
+    EXPECT_EQ(key_latency_serialize(2, data, KEY_LATENCY_SERIALIZED_HEADER_SIZE + 4), KEY_LATENCY_SERIALIZED_HEADER_SIZE + 4);
+    EXPECT_EQ(data[0], KEY_LATENCY_BUCKETS);
+    EXPECT_EQ(data[1], KEY_LATENCY_BUCKET_WIDTH);
+    /* count */
+    EXPECT_EQ(data[5], 3);
+    /* min, avg, max, p99 */
+    EXPECT_EQ(data[7], 3);
+    EXPECT_EQ(data[9], 4);
+    EXPECT_EQ(data[11], 7);
+    EXPECT_EQ(data[13], 7);
+    /* buckets 2 and 3 */
+    EXPECT_EQ(data[15], 0);
+    EXPECT_EQ(data[17], 2);
+
+    EXPECT_EQ(key_latency_serialize(KEY_LATENCY_BUCKETS, data, sizeof(data)), 0);
+    EXPECT_EQ(key_latency_serialize(0, data, KEY_LATENCY_SERIALIZED_HEADER_SIZE - 1), 0);
+}
@@ -0,0 +1,76 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "key_latency.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+class KeyLatencyCoalesced : public TestFixture {
+   public:
+    void SetUp() override {
+        key_latency_reset();
+    }
+
+    key_latency_summary_t summary() {
+        key_latency_summary_t summary;
+        key_latency_get(&summary);
+        return summary;
+    }
+};
+
+TEST_F(KeyLatencyCoalesced, report_sent_at_end_of_scan_is_recorded) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    advance_time(5);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(summary().count, 1);
+    EXPECT_EQ(summary().min, 5);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(summary().count, 2);
+    EXPECT_EQ(summary().min, 0);
+}
+
+TEST_F(KeyLatencyCoalesced, merged_report_records_earliest_edge) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 1, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    key_a.press();
+    advance_time(3);
+    key_b.press();
+    advance_time(2);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // One report answers both edges, timed from the first
+    EXPECT_EQ(summary().count, 1);
+    EXPECT_EQ(summary().max, 5);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
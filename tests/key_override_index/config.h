@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define KEY_OVERRIDE_TRIGGER_INDEX
+#define KEY_OVERRIDE_TRIGGER_INDEX_LENGTH 1024
@@ -0,0 +1,122 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+extern "C" {
+void test_key_overrides_generate(void);
+}
+
+class KeyOverrideIndex : public TestFixture {
+   public:
+    void SetUp() override {
+        test_key_overrides_generate();
+    }
+
+    KeymapKey key_lctl = KeymapKey(0, 0, 0, KC_LEFT_CTRL);
+    KeymapKey key_lalt = KeymapKey(0, 1, 0, KC_LEFT_ALT);
+    KeymapKey key_rctl = KeymapKey(0, 2, 0, KC_RIGHT_CTRL);
+    KeymapKey key_lgui = KeymapKey(0, 3, 0, KC_LEFT_GUI);
+    KeymapKey key_q    = KeymapKey(0, 4, 0, KC_Q);
+    KeymapKey key_z    = KeymapKey(0, 5, 0, KC_Z);
+    KeymapKey key_1    = KeymapKey(0, 6, 0, KC_1);
+
+    void set_test_keymap() {
+        set_keymap({key_lctl, key_lalt, key_rctl, key_lgui, key_q, key_z, key_1});
+    }
+};
+
+TEST_F(KeyOverrideIndex, first_matching_override_wins) {
+    TestDriver driver;
+    set_test_keymap();
+
+    // Override 94 (LALT + KC_Q -> KC_5) comes before its duplicate sending KC_ENTER
+    EXPECT_REPORT(driver, (KC_LEFT_ALT));
+    EXPECT_REPORT(driver, (KC_5)).Times(1);
+    key_lalt.press();
+    run_one_scan_loop();
+    key_q.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_ALT)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    key_q.release();
+    run_one_scan_loop();
+    key_lalt.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, late_override_fires) {
+    TestDriver driver;
+    set_test_keymap();
+
+    // Override 415 (RCTL + KC_Z -> KC_6) is beyond the range of an 8-bit index
+    EXPECT_REPORT(driver, (KC_RIGHT_CTRL));
+    EXPECT_REPORT(driver, (KC_6)).Times(1);
+    key_rctl.press();
+    run_one_scan_loop();
+    key_z.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_RIGHT_CTRL)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    key_z.release();
+    run_one_scan_loop();
+    key_rctl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, mods_only_override_fires) {
+    TestDriver driver;
+    set_test_keymap();
+
+    // The KC_NO trigger override activates on the modifier alone, once the repeat delay has passed
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_ESCAPE)).Times(1);
+    key_lgui.press();
+    idle_for(600); // longer than the default KEY_OVERRIDE_REPEAT_DELAY
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    key_lgui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, keys_without_overrides_pass_through) {
+    TestDriver driver;
+    set_test_keymap();
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_1));
+    key_lctl.press();
+    run_one_scan_loop();
+    key_1.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    key_1.release();
+    run_one_scan_loop();
+    key_lctl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
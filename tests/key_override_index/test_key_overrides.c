@@ -0,0 +1,28 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+#define TEST_KEY_OVERRIDE_LETTERS 26
+#define TEST_KEY_OVERRIDE_MOD_MASKS 23
+#define TEST_KEY_OVERRIDE_COUNT (TEST_KEY_OVERRIDE_LETTERS * TEST_KEY_OVERRIDE_MOD_MASKS + 2)
+
+static key_override_t test_key_overrides[TEST_KEY_OVERRIDE_COUNT];
+
+const key_override_t *key_overrides[TEST_KEY_OVERRIDE_COUNT];
+
+/* Generates an override for every letter with every modifier mask from 1 to 23 (using the left mods and right ctrl):
+ * override n is triggered by KC_A + n % 26 with mods 1 + n / 26, and sends KC_1 + n % 10. Two more follow -- a
+ * mods-only override for either GUI which sends KC_ESCAPE, and a duplicate of override 94 (LALT + KC_Q) which must
+ * never win over the original. */
+void test_key_overrides_generate(void) {
+    for (uint16_t n = 0; n < TEST_KEY_OVERRIDE_COUNT - 2; n++) {
+        test_key_overrides[n] = ko_make_basic(1 + n / TEST_KEY_OVERRIDE_LETTERS, KC_A + n % TEST_KEY_OVERRIDE_LETTERS, KC_1 + n % 10);
+    }
+    test_key_overrides[TEST_KEY_OVERRIDE_COUNT - 2] = ko_make_basic(MOD_MASK_GUI, KC_NO, KC_ESCAPE);
+    test_key_overrides[TEST_KEY_OVERRIDE_COUNT - 1] = ko_make_basic(MOD_BIT(KC_LALT), KC_Q, KC_ENTER);
+
+    for (uint16_t n = 0; n < TEST_KEY_OVERRIDE_COUNT; n++) {
+        key_overrides[n] = &test_key_overrides[n];
+    }
+    key_override_index_invalidate();
+}
@@ -0,0 +1,99 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "matrix_wakeup.h"
+}
+
+using testing::_;
+
+class MatrixWakeup : public TestFixture {};
+
+TEST_F(MatrixWakeup, arms_after_idle_timeout) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({regular_key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(matrix_wakeup_is_armed());
+
+    idle_for(MATRIX_WAKEUP_IDLE_TIMEOUT - 10);
+    EXPECT_FALSE(matrix_wakeup_is_armed());
+
+    idle_for(20);
+    EXPECT_TRUE(matrix_wakeup_is_armed());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWakeup, key_press_wakes_matrix_in_same_scan) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({regular_key});
+
+    idle_for(MATRIX_WAKEUP_IDLE_TIMEOUT * 2);
+    EXPECT_TRUE(matrix_wakeup_is_armed());
+
+    /* Press key, the simulated pin interrupt wakes the matrix. */
+    EXPECT_REPORT(driver, (KC_A));
+    regular_key.press();
+    run_one_scan_loop();
+    EXPECT_FALSE(matrix_wakeup_is_armed());
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release key. */
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWakeup, held_key_keeps_matrix_scanning) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({regular_key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    regular_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_WAKEUP_IDLE_TIMEOUT * 2);
+    EXPECT_FALSE(matrix_wakeup_is_armed());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWakeup, tapping_term_is_respected_after_wakeup) {
+    TestDriver driver;
+    KeymapKey  mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_A));
+    set_keymap({mod_tap_key});
+
+    idle_for(MATRIX_WAKEUP_IDLE_TIMEOUT * 2);
+    EXPECT_TRUE(matrix_wakeup_is_armed());
+
+    /* Press mod-tap key and hold it past the tapping term. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
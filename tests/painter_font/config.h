@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Smaller than the number of glyphs in the test font, so that eviction is exercised
+#define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 4
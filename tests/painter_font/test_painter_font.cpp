@@ -0,0 +1,177 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "qff.h"
+}
+
+static constexpr uint8_t LINE_HEIGHT = 4;
+
+struct test_glyph {
+    uint32_t             code_point;
+    uint8_t              width;
+    std::vector<uint8_t> rows; // one byte per row for every 8 pixels of width, 1bpp
+};
+
+static void append(std::vector<uint8_t>& data, const void* ptr, size_t len) {
+    data.insert(data.end(), (const uint8_t*)ptr, (const uint8_t*)ptr + len);
+}
+
+static qgf_block_header_v1_t make_header(uint8_t type_id, uint32_t length) {
+    qgf_block_header_v1_t header;
+    header.type_id     = type_id;
+    header.neg_type_id = ~type_id;
+    header.length      = length;
+    return header;
+}
+
+// Builds an uncompressed 1bpp QFF font. Glyphs within 0x20..0x7E are placed in the ascii table if requested, with
+// any missing ascii glyphs pointing at the first glyph's data.
+static std::vector<uint8_t> make_font(const std::vector<test_glyph>& glyphs, bool with_ascii_table) {
+    std::vector<uint8_t>                glyph_data;
+    std::vector<qff_ascii_glyph_v1_t>   ascii(95);
+    std::vector<qff_unicode_glyph_v1_t> unicode;
+    for (auto& glyph : glyphs) {
+        uint32_t value = ((uint32_t)glyph_data.size() << QFF_GLYPH_WIDTH_BITS) | glyph.width;
+        append(glyph_data, glyph.rows.data(), glyph.rows.size());
+        if (with_ascii_table && glyph.code_point >= 0x20 && glyph.code_point < 0x7F) {
+            ascii[glyph.code_point - 0x20].value = value;
+        } else {
+            qff_unicode_glyph_v1_t entry;
+            entry.code_point = glyph.code_point;
+            entry.value      = value;
+            unicode.push_back(entry);
+        }
+    }
+    if (with_ascii_table) {
+        for (auto& entry : ascii) {
+            if (entry.value == 0) {
+                entry.value = glyphs[0].width;
+            }
+        }
+    }
+
+    std::vector<uint8_t>     font;
+    qff_font_descriptor_v1_t descriptor;
+    memset(&descriptor, 0, sizeof(descriptor));
+    descriptor.header             = make_header(QFF_FONT_DESCRIPTOR_TYPEID, sizeof(descriptor) - sizeof(qgf_block_header_v1_t));
+    descriptor.magic              = QFF_MAGIC;
+    descriptor.qff_version        = 0x01;
+    descriptor.line_height        = LINE_HEIGHT;
+    descriptor.has_ascii_table    = with_ascii_table;
+    descriptor.num_unicode_glyphs = unicode.size();
+    descriptor.format             = GRAYSCALE_1BPP;
+    descriptor.compression_scheme = IMAGE_UNCOMPRESSED;
+    append(font, &descriptor, sizeof(descriptor));
+
+    if (with_ascii_table) {
+        qgf_block_header_v1_t header = make_header(QFF_ASCII_GLYPH_DESCRIPTOR_TYPEID, 95 * sizeof(qff_ascii_glyph_v1_t));
+        append(font, &header, sizeof(header));
+        append(font, ascii.data(), ascii.size() * sizeof(qff_ascii_glyph_v1_t));
+    }
+    if (!unicode.empty()) {
+        qgf_block_header_v1_t header = make_header(QFF_UNICODE_GLYPH_DESCRIPTOR_TYPEID, unicode.size() * sizeof(qff_unicode_glyph_v1_t));
+        append(font, &header, sizeof(header));
+        append(font, unicode.data(), unicode.size() * sizeof(qff_unicode_glyph_v1_t));
+    }
+    qgf_block_header_v1_t header = make_header(QGF_FRAME_DATA_DESCRIPTOR_TYPEID, glyph_data.size());
+    append(font, &header, sizeof(header));
+    append(font, glyph_data.data(), glyph_data.size());
+
+    // Fix up the total size now that it's known
+    qff_font_descriptor_v1_t* fixup = (qff_font_descriptor_v1_t*)font.data();
+    fixup->total_file_size          = font.size();
+    fixup->neg_total_file_size      = ~fixup->total_file_size;
+    return font;
+}
+
+// More glyphs than the cache can hold, with a mix of widths and patterns
+static const std::vector<test_glyph> test_glyphs = {
+    {'A', 8, {0xFF, 0xFF, 0xFF, 0xFF}},
+    {'B', 16, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
+    {'C', 8, {0xFF, 0xFF, 0x00, 0x00}},
+    {'D', 8, {0x00, 0x00, 0xFF, 0xFF}},
+    {'E', 24, {0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00}},
+    {0x263A, 8, {0xFF, 0x00, 0x00, 0xFF}}, // ☺
+};
+
+class PainterFont : public ::testing::Test {
+   protected:
+    void TearDown() override {
+        if (font) {
+            qp_close_font(font);
+        }
+    }
+
+    painter_font_handle_t load(const std::vector<test_glyph>& glyphs, bool with_ascii_table) {
+        data = make_font(glyphs, with_ascii_table);
+        font = qp_load_font_mem(data.data());
+        return font;
+    }
+
+    std::vector<uint8_t>  data;
+    painter_font_handle_t font = nullptr;
+};
+
+TEST_F(PainterFont, TextWidthMatchesGlyphs) {
+    for (bool with_ascii_table : {false, true}) {
+        ASSERT_NE(load(test_glyphs, with_ascii_table), nullptr);
+        EXPECT_EQ(qp_textwidth(font, "AB☺"), 8 + 16 + 8);
+        EXPECT_EQ(qp_textwidth(font, "☺" "BA"), 8 + 16 + 8) << "Cached glyphs should give the same widths";
+        EXPECT_EQ(qp_textwidth(font, "A☃"), 0) << "Missing glyphs should fail";
+        qp_close_font(font);
+        font = nullptr;
+    }
+}
+
+TEST_F(PainterFont, EvictedGlyphsAreLookedUpAgain) {
+    ASSERT_NE(load(test_glyphs, false), nullptr);
+
+    // Cycle through more glyphs than the cache holds, so every lookup after the first few requires an eviction
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(qp_textwidth(font, "ABCDE☺"), 8 + 16 + 8 + 8 + 24 + 8);
+        EXPECT_EQ(qp_textwidth(font, "EEEA"), 24 * 3 + 8);
+    }
+}
+
+TEST_F(PainterFont, ReloadedFontIgnoresStaleCache) {
+    ASSERT_NE(load(test_glyphs, false), nullptr);
+    EXPECT_EQ(qp_textwidth(font, "A"), 8);
+    qp_close_font(font);
+
+    // The same slot is reused, but 'A' is now a different width
+    std::vector<test_glyph> narrow = {{'A', 16, {0, 0, 0, 0, 0, 0, 0, 0}}};
+    ASSERT_NE(load(narrow, false), nullptr);
+    EXPECT_EQ(qp_textwidth(font, "A"), 16);
+}
+
+TEST_F(PainterFont, DrawTextRendersCachedGlyphs) {
+    static uint8_t          framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(64, LINE_HEIGHT, 16)];
+    static painter_device_t surface = qp_make_rgb565_surface(64, LINE_HEIGHT, framebuffer);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    ASSERT_NE(load(test_glyphs, false), nullptr);
+
+    // Index into test_glyphs of each character drawn
+    const size_t drawn[] = {2, 0, 3, 2, 5};
+
+    // Draw twice so that the second pass is entirely served from the cache
+    for (int i = 0; i < 2; ++i) {
+        memset(framebuffer, 0x55, sizeof(framebuffer));
+        EXPECT_EQ(qp_drawtext(surface, 0, 0, font, "CADC☺"), 40);
+
+        const uint16_t* pixels = (const uint16_t*)framebuffer;
+        for (uint16_t y = 0; y < LINE_HEIGHT; ++y) {
+            for (uint16_t x = 0; x < 40; ++x) {
+                const test_glyph& glyph    = test_glyphs[drawn[x / 8]];
+                bool              expected = glyph.rows[y] != 0;
+                EXPECT_EQ(pixels[y * 64 + x], expected ? 0xFFFF : 0x0000) << "pass " << i << " at " << x << "," << y;
+            }
+        }
+    }
+}
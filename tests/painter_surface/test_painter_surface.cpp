@@ -0,0 +1,282 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_comms_dummy.h"
+#include "qp_surface.h"
+#include "qp_internal_driver.h"
+
+void qp_internal_task(void);
+}
+
+// Bytes a typical SPI panel needs to set a viewport: CASET + 4 bytes, RASET + 4 bytes, RAMWR
+static constexpr uint32_t VIEWPORT_BYTES = 11;
+
+// Target panel which keeps a copy of everything it receives, and counts the bytes sent over the dummy comms
+static struct {
+    uint16_t              width;
+    uint16_t              l, t, r, b;
+    uint16_t              x, y;
+    std::vector<uint16_t> pixels;
+    uint32_t              bytes_sent;
+    uint32_t              viewports;
+} capture;
+
+static void capture_store(uint16_t value) {
+    capture.pixels[capture.y * capture.width + capture.x] = value;
+    if (++capture.x > capture.r) {
+        capture.x = capture.l;
+        if (++capture.y > capture.b) {
+            capture.y = capture.t;
+        }
+    }
+}
+
+static bool capture_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    uint8_t command[VIEWPORT_BYTES] = {0};
+    capture.bytes_sent += qp_comms_send(device, command, sizeof(command));
+    capture.viewports++;
+    capture.l = capture.x = left;
+    capture.t = capture.y = top;
+    capture.r             = right;
+    capture.b             = bottom;
+    return true;
+}
+
+static bool capture_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    capture.bytes_sent += qp_comms_send(device, pixel_data, (native_pixel_count * driver->native_bits_per_pixel + 7) / 8);
+    for (uint32_t i = 0; i < native_pixel_count; ++i) {
+        if (driver->native_bits_per_pixel == 16) {
+            capture_store(((const uint16_t *)pixel_data)[i]);
+        } else {
+            capture_store((((const uint8_t *)pixel_data)[i / 8] >> (i % 8)) & 1);
+        }
+    }
+    return true;
+}
+
+static const painter_driver_vtable_t capture_vtable = {
+    .viewport = capture_viewport,
+    .pixdata  = capture_pixdata,
+};
+
+// Surfaces can't be released once made, so each one is shared between tests and re-initialised by them
+static std::vector<uint16_t> rgb565_framebuffer(240 * 80);
+static std::vector<uint8_t>  mono1bpp_framebuffer(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(128, 64, 1));
+
+static painter_device_t rgb565_surface(void) {
+    static painter_device_t surface = qp_make_rgb565_surface(240, 80, rgb565_framebuffer.data());
+    return surface;
+}
+
+static painter_device_t mono1bpp_surface(void) {
+    static painter_device_t surface = qp_make_mono1bpp_surface(128, 64, mono1bpp_framebuffer.data());
+    return surface;
+}
+
+class PainterSurface : public TestFixture {
+   public:
+    painter_driver_t target = {};
+
+    void make_target(uint16_t width, uint16_t height, uint8_t bpp) {
+        target.driver_vtable         = &capture_vtable;
+        target.comms_vtable          = &dummy_comms_vtable;
+        target.validate_ok           = true;
+        target.panel_width           = width;
+        target.panel_height          = height;
+        target.native_bits_per_pixel = bpp;
+        capture.width                = width;
+        capture.pixels.assign(width * height, 0);
+    }
+
+    // Sends whatever's dirty, returning the number of bytes it took
+    uint32_t draw(painter_device_t surface) {
+        capture.bytes_sent = 0;
+        capture.viewports  = 0;
+        EXPECT_TRUE(qp_surface_draw(surface, &target, 0, 0, false));
+        return capture.bytes_sent;
+    }
+
+    void expect_rgb565_matches(const std::vector<uint16_t> &framebuffer) {
+        EXPECT_EQ(capture.pixels, framebuffer) << "Target contents differ from the surface";
+    }
+
+    void expect_mono1bpp_matches(const std::vector<uint8_t> &framebuffer) {
+        for (size_t i = 0; i < capture.pixels.size(); ++i) {
+            ASSERT_EQ(capture.pixels[i], (framebuffer[i / 8] >> (i % 8)) & 1) << "Target pixel " << i << " differs from the surface";
+        }
+    }
+};
+
+TEST_F(PainterSurface, DistantChangesAreSentSeparately) {
+    auto&            framebuffer = rgb565_framebuffer;
+    painter_device_t surface     = rgb565_surface();
+    make_target(240, 80, 16);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    draw(surface);
+
+    // Two small widgets in opposite corners
+    qp_rect(surface, 0, 0, 9, 9, 0, 255, 255, true);
+    qp_rect(surface, 230, 70, 239, 79, 85, 255, 255, true);
+
+    uint32_t bytes = draw(surface);
+    EXPECT_EQ(capture.viewports, 2);
+    EXPECT_EQ(bytes, 2 * (VIEWPORT_BYTES + 10 * 10 * 2));
+    RecordProperty("bytes_per_flush", bytes);
+    RecordProperty("bounding_box_bytes", VIEWPORT_BYTES + 240 * 80 * 2);
+    expect_rgb565_matches(framebuffer);
+
+    // Nothing has changed since, so nothing is sent
+    EXPECT_EQ(draw(surface), 0);
+}
+
+TEST_F(PainterSurface, NearbyChangesAreMerged) {
+    auto&            framebuffer = rgb565_framebuffer;
+    painter_device_t surface     = rgb565_surface();
+    make_target(240, 80, 16);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    draw(surface);
+
+    // Two rectangles a few pixels apart are cheaper to send as one
+    qp_rect(surface, 20, 20, 29, 29, 0, 255, 255, true);
+    qp_rect(surface, 32, 20, 41, 29, 0, 255, 255, true);
+
+    EXPECT_EQ(draw(surface), VIEWPORT_BYTES + 22 * 10 * 2);
+    EXPECT_EQ(capture.viewports, 1);
+    expect_rgb565_matches(framebuffer);
+}
+
+TEST_F(PainterSurface, RectangleLimitMergesCheapest) {
+    auto&            framebuffer = rgb565_framebuffer;
+    painter_device_t surface     = rgb565_surface();
+    make_target(240, 80, 16);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    draw(surface);
+
+    // More separate changes than can be tracked, so two of them have to share a rectangle
+    for (uint16_t i = 0; i <= SURFACE_DIRTY_RECT_COUNT; ++i) {
+        qp_setpixel(surface, i * 40, (i % 2) * 60, 0, 255, 255);
+    }
+
+    uint32_t bytes = draw(surface);
+    EXPECT_EQ(capture.viewports, SURFACE_DIRTY_RECT_COUNT);
+    EXPECT_LT(bytes, VIEWPORT_BYTES + 240 * 80 * 2);
+    expect_rgb565_matches(framebuffer);
+}
+
+TEST_F(PainterSurface, EntireSurfaceIgnoresDirtyRectangles) {
+    auto&            framebuffer = rgb565_framebuffer;
+    painter_device_t surface     = rgb565_surface();
+    make_target(240, 80, 16);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    draw(surface);
+
+    qp_rect(surface, 0, 0, 9, 9, 0, 255, 255, true);
+    capture.bytes_sent = 0;
+    capture.viewports  = 0;
+    EXPECT_TRUE(qp_surface_draw(surface, &target, 0, 0, true));
+    EXPECT_EQ(capture.viewports, 1);
+    EXPECT_EQ(capture.bytes_sent, VIEWPORT_BYTES + 240 * 80 * 2);
+    expect_rgb565_matches(framebuffer);
+}
+
+TEST_F(PainterSurface, Mono1bppDistantChangesAreSentSeparately) {
+    auto&            framebuffer = mono1bpp_framebuffer;
+    painter_device_t surface     = mono1bpp_surface();
+    make_target(128, 64, 1);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    EXPECT_EQ(draw(surface), VIEWPORT_BYTES + 128 * 64 / 8);
+
+    qp_rect(surface, 1, 1, 12, 6, 0, 0, 255, true);
+    qp_rect(surface, 100, 50, 126, 62, 0, 0, 255, false);
+
+    uint32_t bytes = draw(surface);
+    EXPECT_EQ(capture.viewports, 2);
+    EXPECT_EQ(bytes, 2 * VIEWPORT_BYTES + (12 * 6 + 7) / 8 + (27 * 13 + 7) / 8);
+    expect_mono1bpp_matches(framebuffer);
+}
+
+static int  async_completions;
+static bool async_success;
+
+static void async_complete(painter_device_t surface, bool success, void *cb_arg) {
+    async_completions++;
+    async_success = success;
+    (*(int *)cb_arg)++;
+}
+
+TEST_F(PainterSurface, AsyncDrawIsChunked) {
+    auto&            framebuffer = rgb565_framebuffer;
+    painter_device_t surface     = rgb565_surface();
+    make_target(240, 80, 16);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    qp_rect(surface, 0, 0, 239, 79, 170, 255, 255, true);
+
+    int cb_arg         = 0;
+    async_completions  = 0;
+    capture.bytes_sent = 0;
+    ASSERT_TRUE(qp_surface_draw_async(surface, &target, 0, 0, true, async_complete, &cb_arg));
+    EXPECT_TRUE(qp_surface_draw_in_progress(surface));
+    EXPECT_EQ(capture.bytes_sent, 0) << "Nothing should be sent until the task runs";
+
+    // Each step sends at most one pixdata buffer, preceded by its viewport
+    uint32_t steps = 0, max_step_bytes = 0, viewport_bytes = 0;
+    bool     in_progress;
+    do {
+        uint32_t before_bytes     = capture.bytes_sent;
+        uint32_t before_viewports = capture.viewports;
+        in_progress               = qp_surface_draw_async_task(surface);
+        uint32_t step_bytes       = capture.bytes_sent - before_bytes;
+        viewport_bytes += (capture.viewports - before_viewports) * VIEWPORT_BYTES;
+        max_step_bytes = std::max(max_step_bytes, step_bytes);
+        ++steps;
+    } while (in_progress);
+
+    EXPECT_LE(max_step_bytes, VIEWPORT_BYTES + QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE);
+    EXPECT_GE(steps, (240 * 80 * 2) / QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE);
+    EXPECT_EQ(capture.bytes_sent - viewport_bytes, 240 * 80 * 2);
+    RecordProperty("async_steps", steps);
+    RecordProperty("async_max_step_bytes", max_step_bytes);
+
+    EXPECT_FALSE(qp_surface_draw_in_progress(surface));
+    EXPECT_EQ(async_completions, 1);
+    EXPECT_EQ(cb_arg, 1);
+    EXPECT_TRUE(async_success);
+    expect_rgb565_matches(framebuffer);
+}
+
+TEST_F(PainterSurface, DrawingContinuesDuringAsyncDraw) {
+    auto&            framebuffer = rgb565_framebuffer;
+    painter_device_t surface     = rgb565_surface();
+    make_target(240, 80, 16);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+    async_completions = 0;
+    ASSERT_TRUE(qp_surface_draw_async(surface, &target, 0, 0, false, async_complete, &async_completions));
+    EXPECT_FALSE(qp_surface_draw_async(surface, &target, 0, 0, false, NULL, NULL)) << "Second draw should be rejected while one is in progress";
+    qp_surface_draw_async_task(surface);
+    qp_surface_draw_async_task(surface);
+
+    // Change areas which have already been sent, and which haven't been sent yet
+    qp_rect(surface, 0, 0, 9, 1, 0, 255, 255, true);
+    qp_rect(surface, 0, 70, 239, 79, 85, 255, 255, true);
+
+    // The Quantum Painter task moves the transfer along
+    for (int i = 0; i < 1000 && qp_surface_draw_in_progress(surface); ++i) {
+        qp_internal_task();
+    }
+    EXPECT_FALSE(qp_surface_draw_in_progress(surface));
+    EXPECT_EQ(async_completions, 2) << "Completion callback should fire exactly once";
+
+    // Anything changed during the transfer is picked up by the next one
+    draw(surface);
+    expect_rgb565_matches(framebuffer);
+}
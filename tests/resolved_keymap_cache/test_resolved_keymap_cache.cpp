@@ -0,0 +1,113 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class ResolvedKeymapCache : public TestFixture {};
+
+TEST_F(ResolvedKeymapCache, resolves_transparent_keys_to_lower_layer) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+    set_keymap({regular_key, KeymapKey{1, 1, 0, KC_TRNS}});
+
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ResolvedKeymapCache, layer_change_invalidates_cache) {
+    TestDriver driver;
+    KeymapKey  layer_key   = KeymapKey{0, 0, 0, MO(1)};
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+    set_keymap({layer_key, regular_key, KeymapKey{1, 1, 0, KC_B}});
+
+    /* Resolve the key on layer 0 first. */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Press MO. */
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The same key now resolves on layer 1. */
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release MO */
+    EXPECT_NO_REPORT(driver);
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* And back on layer 0. */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ResolvedKeymapCache, key_released_after_layer_change_uses_source_layer) {
+    TestDriver driver;
+    KeymapKey  layer_key   = KeymapKey{0, 0, 0, MO(1)};
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+    set_keymap({layer_key, regular_key, KeymapKey{1, 1, 0, KC_B}});
+
+    /* Press key on layer 0 */
+    EXPECT_REPORT(driver, (KC_A));
+    regular_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Press MO. */
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release of the key still releases KC_A */
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release MO */
+    EXPECT_NO_REPORT(driver);
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ResolvedKeymapCache, default_layer_change_invalidates_cache) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+    set_keymap({regular_key, KeymapKey{1, 1, 0, KC_B}});
+
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+
+    default_layer_set((layer_state_t)1 << 1);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 1);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    default_layer_set((layer_state_t)1 << 0);
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+}
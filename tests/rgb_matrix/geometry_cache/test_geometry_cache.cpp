@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+extern const led_point_t k_rgb_matrix_center;
+}
+
+class GeometryCache : public TestFixture {};
+
+static void expect_geometry_matches_layout() {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        EXPECT_EQ(g_rgb_matrix_geometry[i].dist, (uint8_t)sqrt16(dx * dx + dy * dy)) << "LED " << +i;
+        EXPECT_EQ(g_rgb_matrix_geometry[i].angle, atan2_8(dy, dx)) << "LED " << +i;
+    }
+}
+
+TEST_F(GeometryCache, MatchesLayoutAfterInit) {
+    expect_geometry_matches_layout();
+}
+
+TEST_F(GeometryCache, UpdateFollowsLayoutChanges) {
+    led_point_t saved = g_led_config.point[0];
+
+    g_led_config.point[0] = k_rgb_matrix_center;
+    rgb_matrix_update_geometry();
+    EXPECT_EQ(g_rgb_matrix_geometry[0].dist, 0);
+    expect_geometry_matches_layout();
+
+    g_led_config.point[0] = saved;
+    rgb_matrix_update_geometry();
+    expect_geometry_matches_layout();
+}
@@ -0,0 +1,68 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "../rgb_matrix_leds.h"
+
+void advance_time(uint32_t ms);
+}
+
+static std::vector<uint8_t> batch_sizes;
+static bool                 black_out = false;
+
+extern "C" void rgb_matrix_hsv_to_rgb_buffer(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    batch_sizes.push_back(count);
+    hsv_to_rgb_buffer(hsv, rgb, count);
+    if (black_out) {
+        for (uint8_t i = 0; i < count; i++) {
+            rgb[i] = (rgb_t){0, 0, 0};
+        }
+    }
+}
+
+class HsvBatch : public TestFixture {
+   protected:
+    void SetUp() override {
+        batch_sizes.clear();
+        black_out = false;
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_LEFT_RIGHT);
+        render_frame();
+        batch_sizes.clear();
+    }
+
+    void render_frame() {
+        uint32_t flushes = rgb_matrix_leds_flush_count();
+        while (rgb_matrix_leds_flush_count() == flushes) {
+            rgb_matrix_task();
+        }
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+    }
+};
+
+TEST_F(HsvBatch, ConvertsEveryLedInBatches) {
+    render_frame();
+
+    unsigned total = 0;
+    for (uint8_t size : batch_sizes) {
+        EXPECT_LE(size, RGB_MATRIX_HSV_BATCH_SIZE);
+        total += size;
+    }
+    EXPECT_EQ(total, RGB_MATRIX_LED_COUNT);
+    EXPECT_EQ(batch_sizes.size(), (RGB_MATRIX_LED_COUNT + RGB_MATRIX_HSV_BATCH_SIZE - 1) / RGB_MATRIX_HSV_BATCH_SIZE);
+}
+
+TEST_F(HsvBatch, BufferOverrideAppliesToEveryLed) {
+    black_out = true;
+    render_frame();
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_t rgb = rgb_matrix_leds_get_color(i);
+        EXPECT_EQ(rgb.r | rgb.g | rgb.b, 0) << "LED " << +i;
+    }
+}
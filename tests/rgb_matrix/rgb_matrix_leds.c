@@ -0,0 +1,70 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+#include "rgb_matrix_leds.h"
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        {   0,   1,   2,   3,   4,   5,   6,   7,   8,   9 },
+        {  10,  11,  12,  13,  14,  15,  16,  17,  18,  19 },
+        {  20,  21,  22,  23,  24,  25,  26,  27,  28,  29 },
+        {  30,  31,  32,  33,  34,  35,  36,  37,  38,  39 },
+    }, {
+        {  0,  0}, { 25,  0}, { 50,  0}, { 75,  0}, {100,  0}, {124,  0}, {149,  0}, {174,  0}, {199,  0}, {224,  0},
+        {  0, 21}, { 25, 21}, { 50, 21}, { 75, 21}, {100, 21}, {124, 21}, {149, 21}, {174, 21}, {199, 21}, {224, 21},
+        {  0, 43}, { 25, 43}, { 50, 43}, { 75, 43}, {100, 43}, {124, 43}, {149, 43}, {174, 43}, {199, 43}, {224, 43},
+        {  0, 64}, { 25, 64}, { 50, 64}, { 75, 64}, {100, 64}, {124, 64}, {149, 64}, {174, 64}, {199, 64}, {224, 64},
+        {  0,  0}, {  8,  0}, { 15,  0}, { 23,  0}, { 31,  0}, { 39,  0}, { 46,  0}, { 54,  0}, { 62,  0}, { 70,  0},
+        { 77,  0}, { 85,  0}, { 93,  0}, {100,  0}, {108,  0}, {116,  0}, {124,  0}, {131,  0}, {139,  0}, {147,  0},
+        {154,  0}, {162,  0}, {170,  0}, {178,  0}, {185,  0}, {193,  0}, {201,  0}, {209,  0}, {216,  0}, {224,  0},
+        {224,  6}, {224, 12}, {224, 17}, {224, 23}, {224, 29}, {224, 35}, {224, 41}, {224, 47}, {224, 52}, {224, 58},
+        {224, 64}, {216, 64}, {209, 64}, {201, 64}, {193, 64}, {185, 64}, {178, 64}, {170, 64}, {162, 64}, {154, 64},
+        {147, 64}, {139, 64}, {131, 64}, {124, 64}, {116, 64}, {108, 64}, {100, 64}, { 93, 64}, { 85, 64}, { 77, 64},
+        { 70, 64}, { 62, 64}, { 54, 64}, { 46, 64}, { 39, 64}, { 31, 64}, { 23, 64}, { 15, 64}, {  8, 64}, {  0, 64},
+        {  0, 58}, {  0, 52}, {  0, 47}, {  0, 41}, {  0, 35}, {  0, 29}, {  0, 23}, {  0, 17}, {  0, 12}, {  0,  6}
+    }, {
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+    }
+};
+// clang-format on
+
+static rgb_t    led_buffer[RGB_MATRIX_LED_COUNT];
+static uint32_t flush_count = 0;
+
+static void init(void) {}
+
+static void set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    led_buffer[index] = (rgb_t){.r = r, .g = g, .b = b};
+}
+
+static void set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        set_color(i, r, g, b);
+    }
+}
+
+static void flush(void) {
+    flush_count++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = init,
+    .set_color     = set_color,
+    .set_color_all = set_color_all,
+    .flush         = flush,
+};
+
+uint32_t rgb_matrix_leds_flush_count(void) {
+    return flush_count;
+}
+
+rgb_t rgb_matrix_leds_get_color(uint8_t index) {
+    return led_buffer[index];
+}
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "color.h"
+
+/* Test driver for a 120 LED board: the 4x10 test matrix plus an underglow ring. */
+uint32_t rgb_matrix_leds_flush_count(void);
+rgb_t    rgb_matrix_leds_get_color(uint8_t index);
@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+}
+
+/* The original per-LED conversion, kept here as the reference for the optimised kernel. */
+static rgb_t reference_hsv_to_rgb(hsv_t hsv) {
+    uint8_t  region, remainder, p, q, t;
+    uint16_t h = hsv.h, s = hsv.s, v = hsv.v;
+
+    if (s == 0) {
+        return (rgb_t){hsv.v, hsv.v, hsv.v};
+    }
+
+    region    = h * 6 / 255;
+    remainder = (h * 2 - region * 85) * 3;
+
+    p = (v * (255 - s)) >> 8;
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 6:
+        case 0:
+            return (rgb_t){(uint8_t)v, t, p};
+        case 1:
+            return (rgb_t){q, (uint8_t)v, p};
+        case 2:
+            return (rgb_t){p, (uint8_t)v, t};
+        case 3:
+            return (rgb_t){p, q, (uint8_t)v};
+        case 4:
+            return (rgb_t){t, p, (uint8_t)v};
+        default:
+            return (rgb_t){(uint8_t)v, p, q};
+    }
+}
+
+static bool rgb_equal(rgb_t a, rgb_t b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+TEST(HsvToRgb, MatchesReferenceForEveryColor) {
+    hsv_t hsv[256];
+    rgb_t rgb[256];
+
+    for (int h = 0; h < 256; h++) {
+        for (int s = 0; s < 256; s++) {
+            for (int v = 0; v < 256; v++) {
+                hsv[v] = (hsv_t){(uint8_t)h, (uint8_t)s, (uint8_t)v};
+            }
+            hsv_to_rgb_buffer(hsv, rgb, 256);
+
+            for (int v = 0; v < 256; v++) {
+                ASSERT_TRUE(rgb_equal(hsv_to_rgb_nocie(hsv[v]), reference_hsv_to_rgb(hsv[v]))) << "hsv " << h << "," << s << "," << v;
+                ASSERT_TRUE(rgb_equal(rgb[v], hsv_to_rgb(hsv[v]))) << "batched hsv " << h << "," << s << "," << v;
+            }
+        }
+    }
+}
+
+TEST(HsvToRgb, BufferConvertsInPlace) {
+    hsv_t buffer[] = {{HSV_RED}, {HSV_RED}, {HSV_TEAL}, {HSV_CORAL}, {HSV_CORAL}, {0, 0, 0}};
+    hsv_t colors[sizeof(buffer) / sizeof(buffer[0])];
+    memcpy(colors, buffer, sizeof(buffer));
+
+    hsv_to_rgb_buffer(buffer, (rgb_t *)buffer, sizeof(buffer) / sizeof(buffer[0]));
+
+    for (size_t i = 0; i < sizeof(buffer) / sizeof(buffer[0]); i++) {
+        rgb_t rgb = *(rgb_t *)&buffer[i];
+        EXPECT_TRUE(rgb_equal(rgb, hsv_to_rgb(colors[i]))) << "index " << i;
+    }
+}
@@ -0,0 +1,167 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "transactions.h"
+#include "../split_loopback.h"
+
+void advance_time(uint32_t ms);
+}
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+
+struct key_change_t {
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+    uint16_t time;
+
+    bool operator==(const key_change_t &other) const {
+        return row == other.row && col == other.col && pressed == other.pressed;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const key_change_t &change) {
+    return os << "(" << +change.row << "," << +change.col << (change.pressed ? " down" : " up") << ")";
+}
+
+class MatrixDelta : public TestFixture {
+   protected:
+    TestDriver   driver;
+    matrix_row_t master_matrix[ROWS_PER_HAND] = {0};
+    matrix_row_t slave_side[ROWS_PER_HAND]    = {0};
+    matrix_row_t slave_matrix[ROWS_PER_HAND]  = {0};
+
+    void SetUp() override {
+        split_loopback_set_link_down(false);
+        memset(slave_side, 0, sizeof(slave_side));
+        split_loopback_slave_task(master_matrix, slave_side);
+        // Drain whatever the previous test left queued
+        for (int i = 0; i < 8; i++) {
+            transactions_master(master_matrix, slave_matrix);
+        }
+        split_loopback_take_stats();
+    }
+
+    /* One slave scan that sees a single key change. */
+    key_change_t slave_scan(uint8_t row, uint8_t col, bool pressed) {
+        advance_time(1);
+        if (pressed) {
+            slave_side[row] |= (matrix_row_t)1 << col;
+        } else {
+            slave_side[row] &= ~((matrix_row_t)1 << col);
+        }
+        split_loopback_slave_task(master_matrix, slave_side);
+        return {row, col, pressed, timer_read()};
+    }
+
+    /* Runs master cycles until the slave matrix stops changing, collecting the changes each scan would process, in scan order. */
+    std::vector<key_change_t> master_scans() {
+        std::vector<key_change_t> changes;
+        for (int cycle = 0; cycle < 32; cycle++) {
+            matrix_row_t previous[ROWS_PER_HAND];
+            memcpy(previous, slave_matrix, sizeof(previous));
+            EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+            for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    if ((previous[row] ^ slave_matrix[row]) & ((matrix_row_t)1 << col)) {
+                        changes.push_back({row, col, (bool)((slave_matrix[row] >> col) & 1), transactions_slave_edge_time(row)});
+                    }
+                }
+            }
+        }
+        return changes;
+    }
+};
+
+TEST_F(MatrixDelta, IdleCycleOnlyReadsSequence) {
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+
+    split_loopback_stats_t stats = split_loopback_take_stats();
+    EXPECT_EQ(stats.transactions, 1);
+    EXPECT_EQ(stats.bytes, sizeof(uint8_t));
+}
+
+TEST_F(MatrixDelta, RollingInputIsReplayedInOrder) {
+    // A fast roll across both rows, entirely between two master cycles
+    std::vector<key_change_t> rolled = {
+        slave_scan(1, 4, true), slave_scan(0, 7, true), slave_scan(1, 2, true), slave_scan(1, 4, false), slave_scan(0, 1, true), slave_scan(0, 7, false), slave_scan(1, 2, false), slave_scan(0, 1, false),
+    };
+
+    std::vector<key_change_t> seen = master_scans();
+    EXPECT_EQ(seen, rolled);
+    EXPECT_EQ(memcmp(slave_matrix, slave_side, sizeof(slave_side)), 0);
+}
+
+TEST_F(MatrixDelta, TapWithinOneCycleIsNotLost) {
+    std::vector<key_change_t> tapped = {slave_scan(0, 3, true), slave_scan(0, 3, false)};
+
+    EXPECT_EQ(master_scans(), tapped);
+}
+
+TEST_F(MatrixDelta, EdgeTimeIsWhenTheSlaveSawTheChange) {
+    key_change_t pressed = slave_scan(1, 6, true);
+    advance_time(20);
+
+    std::vector<key_change_t> seen = master_scans();
+    ASSERT_EQ(seen.size(), 1);
+    EXPECT_EQ(seen[0].time, pressed.time);
+}
+
+TEST_F(MatrixDelta, InterleavedCyclesSendOnlyNewEvents) {
+    slave_scan(0, 5, true);
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(slave_matrix[0], (matrix_row_t)1 << 5);
+
+    split_loopback_stats_t stats = split_loopback_take_stats();
+    EXPECT_EQ(stats.transactions, 2);
+    EXPECT_EQ(stats.bytes, sizeof(uint8_t) + offsetof(split_slave_events_sync_t, events) + SPLIT_MATRIX_EVENT_RECENT * sizeof(split_matrix_event_t));
+
+    slave_scan(0, 5, false);
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(slave_matrix[0], 0);
+}
+
+TEST_F(MatrixDelta, ManyNewEventsReadWholeQueue) {
+    for (uint8_t col = 0; col < SPLIT_MATRIX_EVENT_RECENT + 1; col++) {
+        slave_scan(0, col, true);
+    }
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(memcmp(slave_matrix, slave_side, sizeof(slave_side)), 0);
+
+    split_loopback_stats_t stats = split_loopback_take_stats();
+    EXPECT_EQ(stats.transactions, 2);
+    EXPECT_EQ(stats.bytes, sizeof(uint8_t) + sizeof(split_slave_events_sync_t));
+}
+
+TEST_F(MatrixDelta, PackedResponseOmitsMatrix) {
+    set_mods(MOD_BIT(KC_LEFT_SHIFT));
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    clear_mods();
+
+    split_loopback_stats_t stats = split_loopback_take_stats();
+    EXPECT_EQ(stats.transactions, 2);
+    EXPECT_EQ(stats.bytes, sizeof(uint8_t) + sizeof(split_shared_memory_t::packed) + sizeof(split_shared_memory_t::packed_ack));
+}
+
+TEST_F(MatrixDelta, OverflowFallsBackToFullMatrix) {
+    for (uint8_t col = 0; col < SPLIT_MATRIX_EVENT_COUNT + 2; col++) {
+        slave_scan(col & 1, col, true);
+    }
+
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(memcmp(slave_matrix, slave_side, sizeof(slave_side)), 0);
+}
+
+TEST_F(MatrixDelta, CorruptQueueIsNotApplied) {
+    slave_scan(1, 1, true);
+    split_loopback_slave_shmem()->sevents.events[0].col ^= 0x04;
+    split_loopback_slave_shmem()->sevents.events[1].col ^= 0x04;
+
+    EXPECT_FALSE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(slave_matrix[1], 0);
+}
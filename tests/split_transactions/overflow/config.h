@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../config.h"
+
+// Room for the layer states, but not for the mods as well
+#define SPLIT_TRANSACTION_PACKED_SIZE (2 * sizeof(layer_state_t))
@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "transactions.h"
+#include "../split_loopback.h"
+}
+
+#define SECTION(id) ((uint32_t)1 << (id))
+
+class PackedOverflow : public TestFixture {
+   protected:
+    TestDriver   driver;
+    matrix_row_t master_matrix[MATRIX_ROWS / 2] = {0};
+    matrix_row_t slave_matrix[MATRIX_ROWS / 2]  = {0};
+
+    void SetUp() override {
+        split_loopback_set_link_down(false);
+        layer_state         = 0;
+        default_layer_state = 1;
+        clear_mods();
+        for (int i = 0; i < 4; i++) {
+            transactions_master(master_matrix, slave_matrix);
+            split_loopback_slave_task(master_matrix, slave_matrix);
+        }
+    }
+
+    const split_packed_sync_t &sent_frame() {
+        return split_loopback_slave_shmem()->packed;
+    }
+};
+
+TEST_F(PackedOverflow, SectionLeftOutIsNotAcknowledgedByLaterFrame) {
+    set_mods(MOD_BIT(KC_LEFT_SHIFT));
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(sent_frame().sections, SECTION(PUT_MODS));
+
+    // The layer states fill the next frame, and the slave only gets to unpack that one
+    layer_state         = 0b110;
+    default_layer_state = 0b10;
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(sent_frame().sections, SECTION(PUT_LAYER_STATE) | SECTION(PUT_DEFAULT_LAYER_STATE));
+    split_loopback_slave_task(master_matrix, slave_matrix);
+    EXPECT_NE(split_loopback_slave_shmem()->mods.real_mods, MOD_BIT(KC_LEFT_SHIFT));
+
+    // Acknowledging a frame without the mods must not count as delivering them
+    for (int i = 0; i < 4; i++) {
+        // Both halves share the globals here, and the slave has just applied its stale mods
+        set_mods(MOD_BIT(KC_LEFT_SHIFT));
+        EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+        split_loopback_slave_task(master_matrix, slave_matrix);
+    }
+    EXPECT_EQ(split_loopback_slave_shmem()->mods.real_mods, MOD_BIT(KC_LEFT_SHIFT));
+    EXPECT_EQ(split_loopback_slave_shmem()->layers.layer_state, 0b110);
+    EXPECT_EQ(split_loopback_slave_shmem()->layers.default_layer_state, 0b10);
+}
+
+TEST_F(PackedOverflow, SettlesOnceEverythingIsAcknowledged) {
+    for (int i = 0; i < 4; i++) {
+        set_mods(MOD_BIT(KC_LEFT_ALT));
+        layer_state = 0b10;
+        EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+        split_loopback_slave_task(master_matrix, slave_matrix);
+    }
+    EXPECT_EQ(split_loopback_slave_shmem()->mods.real_mods, MOD_BIT(KC_LEFT_ALT));
+    EXPECT_EQ(split_loopback_slave_shmem()->layers.layer_state, 0b10);
+
+    // Nothing is left in flight, so the frame isn't sent again
+    uint8_t sequence = sent_frame().sequence;
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(sent_frame().sequence, sequence);
+}
@@ -0,0 +1,77 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "serial.h"
+#include "transport.h"
+#include "split_loopback.h"
+
+static split_shared_memory_t slave_shmem;
+static split_shared_memory_t master_shmem;
+static split_loopback_stats_t stats;
+static bool                   link_down = false;
+
+static void run_as_slave(void (*task)(void *), void *arg) {
+    memcpy(&master_shmem, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &slave_shmem, sizeof(split_shared_memory_t));
+    task(arg);
+    memcpy(&slave_shmem, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &master_shmem, sizeof(split_shared_memory_t));
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+static void run_slave_callback(void *arg) {
+    split_transaction_desc_t *trans = arg;
+    trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+}
+
+/* Behaves like the ChibiOS serial protocol: the slave receives the initiator buffer, runs the callback, then replies. */
+bool soft_serial_transaction(int sstd_index) {
+    if (link_down) {
+        return false;
+    }
+
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+    stats.transactions++;
+    stats.bytes += trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+
+    memcpy((uint8_t *)&slave_shmem + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    if (trans->slave_callback) {
+        run_as_slave(run_slave_callback, trans);
+    }
+    memcpy(split_trans_target2initiator_buffer(trans), (uint8_t *)&slave_shmem + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+    return true;
+}
+
+typedef struct {
+    matrix_row_t *master_matrix;
+    matrix_row_t *slave_matrix;
+} slave_task_args_t;
+
+static void run_transactions_slave(void *arg) {
+    slave_task_args_t *args = arg;
+    transactions_slave(args->master_matrix, args->slave_matrix);
+}
+
+void split_loopback_slave_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    slave_task_args_t args = {master_matrix, slave_matrix};
+    run_as_slave(run_transactions_slave, &args);
+}
+
+split_shared_memory_t *split_loopback_slave_shmem(void) {
+    return &slave_shmem;
+}
+
+split_loopback_stats_t split_loopback_take_stats(void) {
+    split_loopback_stats_t taken = stats;
+    memset(&stats, 0, sizeof(stats));
+    return taken;
+}
+
+void split_loopback_set_link_down(bool down) {
+    link_down = down;
+}
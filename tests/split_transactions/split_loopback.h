@@ -0,0 +1,21 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "matrix.h"
+#include "transport.h"
+
+/* In-process serial link, with the slave's shared memory kept separate from the master's. */
+typedef struct {
+    uint32_t transactions;
+    uint32_t bytes;
+} split_loopback_stats_t;
+
+void                   split_loopback_slave_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+split_shared_memory_t *split_loopback_slave_shmem(void);
+split_loopback_stats_t split_loopback_take_stats(void);
+void                   split_loopback_set_link_down(bool down);
@@ -0,0 +1,11 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+SPLIT_KEYBOARD = yes
+SPLIT_TRANSPORT = custom
+
+SRC += transport.c transactions.c split_loopback.c
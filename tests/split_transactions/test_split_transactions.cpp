@@ -0,0 +1,124 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "transactions.h"
+#include "split_loopback.h"
+}
+
+#define SECTION(id) ((uint32_t)1 << (id))
+
+class SplitTransactions : public TestFixture {
+   protected:
+    TestDriver   driver;
+    matrix_row_t master_matrix[MATRIX_ROWS / 2] = {0};
+    matrix_row_t slave_matrix[MATRIX_ROWS / 2]  = {0};
+
+    void SetUp() override {
+        split_loopback_set_link_down(false);
+        layer_state         = 0;
+        default_layer_state = 1;
+        clear_mods();
+        settle();
+    }
+
+    /* Runs both halves until the slave has acknowledged everything, so each test starts from a quiet link. */
+    void settle() {
+        for (int i = 0; i < 4; i++) {
+            transactions_master(master_matrix, slave_matrix);
+            split_loopback_slave_task(master_matrix, slave_matrix);
+        }
+        split_loopback_take_stats();
+    }
+
+    const split_packed_sync_t &sent_frame() {
+        return split_loopback_slave_shmem()->packed;
+    }
+};
+
+TEST_F(SplitTransactions, IdleCycleOnlyReadsMatrixChecksum) {
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+
+    split_loopback_stats_t stats = split_loopback_take_stats();
+    EXPECT_EQ(stats.transactions, 1);
+    EXPECT_EQ(stats.bytes, sizeof(uint8_t));
+}
+
+TEST_F(SplitTransactions, ChangesShareOneFrame) {
+    uint8_t sequence = sent_frame().sequence;
+
+    layer_state         = 0b110;
+    default_layer_state = 0b10;
+    set_mods(MOD_BIT(KC_LEFT_SHIFT));
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+
+    EXPECT_EQ(split_loopback_take_stats().transactions, 1);
+    EXPECT_NE(sent_frame().sequence, sequence);
+    EXPECT_EQ(sent_frame().sections, SECTION(PUT_LAYER_STATE) | SECTION(PUT_DEFAULT_LAYER_STATE) | SECTION(PUT_MODS));
+
+    split_loopback_slave_task(master_matrix, slave_matrix);
+    split_shared_memory_t *slave = split_loopback_slave_shmem();
+    EXPECT_EQ(slave->packed_ack, sent_frame().sequence);
+    EXPECT_EQ(slave->layers.layer_state, 0b110);
+    EXPECT_EQ(slave->layers.default_layer_state, 0b10);
+    EXPECT_EQ(slave->mods.real_mods, MOD_BIT(KC_LEFT_SHIFT));
+}
+
+TEST_F(SplitTransactions, SlaveMatrixRidesOnTheResponse) {
+    matrix_row_t slave_side[MATRIX_ROWS / 2] = {0b101, 0b011};
+    split_loopback_slave_task(master_matrix, slave_side);
+
+    set_mods(MOD_BIT(KC_LEFT_CTRL));
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+
+    EXPECT_EQ(split_loopback_take_stats().transactions, 1);
+    EXPECT_EQ(slave_matrix[0], 0b101);
+    EXPECT_EQ(slave_matrix[1], 0b011);
+}
+
+TEST_F(SplitTransactions, ResendsUntilSlaveAcknowledges) {
+    layer_state = 0b10;
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+
+    // The slave hasn't unpacked the first frame, so the second one carries the layer state again
+    set_mods(MOD_BIT(KC_LEFT_ALT));
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(sent_frame().sections, SECTION(PUT_LAYER_STATE) | SECTION(PUT_MODS));
+
+    split_loopback_slave_task(master_matrix, slave_matrix);
+    EXPECT_EQ(split_loopback_slave_shmem()->layers.layer_state, 0b10);
+
+    // Once the acknowledgement has come back, the layer state is no longer sent
+    set_mods(0);
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    set_mods(MOD_BIT(KC_LEFT_ALT));
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(sent_frame().sections, SECTION(PUT_MODS));
+}
+
+TEST_F(SplitTransactions, CorruptFrameIsNotApplied) {
+    uint8_t ack = split_loopback_slave_shmem()->packed_ack;
+
+    layer_state = 0b1000;
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    split_loopback_slave_shmem()->packed.payload[0] ^= 0xFF;
+    split_loopback_slave_task(master_matrix, slave_matrix);
+
+    EXPECT_EQ(split_loopback_slave_shmem()->packed_ack, ack);
+    EXPECT_NE(split_loopback_slave_shmem()->layers.layer_state, 0b1000);
+}
+
+TEST_F(SplitTransactions, FailedFrameIsRetried) {
+    split_loopback_set_link_down(true);
+    set_mods(MOD_BIT(KC_RIGHT_GUI));
+    EXPECT_FALSE(transactions_master(master_matrix, slave_matrix));
+
+    split_loopback_set_link_down(false);
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(sent_frame().sections, SECTION(PUT_MODS));
+
+    split_loopback_slave_task(master_matrix, slave_matrix);
+    EXPECT_EQ(split_loopback_slave_shmem()->mods.real_mods, MOD_BIT(KC_RIGHT_GUI));
+}
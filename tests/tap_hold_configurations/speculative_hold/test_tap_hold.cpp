@@ -0,0 +1,277 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class SpeculativeHold : public TestFixture {};
+
+TEST_F(SpeculativeHold, tap_mod_tap_key) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    /* Press mod-tap key. Shift is registered immediately. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    mod_tap_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap key. Shift is retracted before the tap. */
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SpeculativeHold, hold_mod_tap_key) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, RCTL_T(KC_P));
+    auto       regular_key = KeymapKey(0, 2, 0, KC_A);
+
+    set_keymap({mod_tap_key, regular_key});
+
+    /* Press mod-tap key. */
+    EXPECT_REPORT(driver, (KC_RCTL));
+    mod_tap_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Idle past the tapping term. Settling as held sends nothing new. */
+    EXPECT_NO_REPORT(driver);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Tap regular key. */
+    EXPECT_REPORT(driver, (KC_RCTL, KC_A));
+    EXPECT_REPORT(driver, (KC_RCTL));
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap key. */
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SpeculativeHold, tap_regular_key_while_mod_tap_key_is_held) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    auto       regular_key = KeymapKey(0, 2, 0, KC_A);
+
+    set_keymap({mod_tap_key, regular_key});
+
+    /* Press mod-tap key. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    mod_tap_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Tap regular key. It waits in the buffer while the mod-tap key is unsettled. */
+    EXPECT_NO_REPORT(driver);
+    regular_key.press();
+    run_one_scan_loop();
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap key. Shift must not leak onto the buffered key. */
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_REPORT(driver, (KC_P, KC_A));
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SpeculativeHold, roll_two_mod_tap_keys) {
+    TestDriver driver;
+    InSequence s;
+    auto       first_mod_tap_key  = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    auto       second_mod_tap_key = KeymapKey(0, 2, 0, RSFT_T(KC_A));
+
+    set_keymap({first_mod_tap_key, second_mod_tap_key});
+
+    /* Press first mod-tap key. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    first_mod_tap_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Press second mod-tap key. Only the unsettled tapping key speculates. */
+    EXPECT_NO_REPORT(driver);
+    second_mod_tap_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release first mod-tap key. */
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    first_mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release second mod-tap key. */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    second_mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SpeculativeHold, tap_mod_tap_key_two_times) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    /* Tap mod-tap key. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(mod_tap_key);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Press mod-tap key again within the quick tap term. This is a repeated
+     * tap, so nothing is speculated. */
+    EXPECT_REPORT(driver, (KC_P));
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap key. */
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SpeculativeHold, only_shift_and_ctrl_are_speculated_by_default) {
+    TestDriver driver;
+    InSequence s;
+    auto       alt_key        = KeymapKey(0, 1, 0, LALT_T(KC_P));
+    auto       ctrl_shift_key = KeymapKey(0, 2, 0, C_S_T(KC_A));
+
+    set_keymap({alt_key, ctrl_shift_key});
+
+    /* Tap Alt mod-tap key. */
+    EXPECT_NO_REPORT(driver);
+    alt_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    alt_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    idle_for(TAPPING_TERM);
+
+    /* A Ctrl+Shift mod-tap key is speculated as a whole. */
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    ctrl_shift_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    ctrl_shift_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SpeculativeHold, mod_already_held_is_left_alone) {
+    TestDriver driver;
+    InSequence s;
+    auto       shift_key   = KeymapKey(0, 1, 0, KC_LSFT);
+    auto       mod_tap_key = KeymapKey(0, 2, 0, SFT_T(KC_P));
+
+    set_keymap({shift_key, mod_tap_key});
+
+    /* Hold Shift. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    shift_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Press mod-tap key. Shift is already held, so nothing is sent. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap key. The tap keeps the Shift held by the other key. */
+    EXPECT_REPORT(driver, (KC_LSFT, KC_P));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release Shift. */
+    EXPECT_EMPTY_REPORT(driver);
+    shift_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Measures the time from pressing a mod-tap key to the host first seeing its
+ * modifier, with and without speculation. */
+TEST_F(SpeculativeHold, hold_latency) {
+    TestDriver driver;
+    auto       shift_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    auto       alt_key   = KeymapKey(0, 2, 0, LALT_T(KC_A));
+
+    set_keymap({shift_key, alt_key});
+
+    auto measure = [&](KeymapKey &key, uint8_t mods) {
+        bool mods_seen = false;
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly([&](report_keyboard_t &report) {
+            mods_seen |= (report.mods & mods) == mods;
+        });
+        const uint16_t start   = timer_read();
+        uint16_t       latency = 0;
+        key.press();
+        run_one_scan_loop();
+        while (!mods_seen && timer_elapsed(start) <= TAPPING_TERM + 10) {
+            run_one_scan_loop();
+        }
+        if (mods_seen) {
+            latency = timer_elapsed(start);
+        }
+        key.release();
+        idle_for(TAPPING_TERM);
+        VERIFY_AND_CLEAR(driver);
+        EXPECT_TRUE(mods_seen);
+        return latency;
+    };
+
+    const uint16_t speculative_latency = measure(shift_key, MOD_BIT_LSHIFT);
+    const uint16_t regular_latency     = measure(alt_key, MOD_BIT_LALT);
+
+    RecordProperty("speculative_hold_latency_ms", speculative_latency);
+    RecordProperty("regular_hold_latency_ms", regular_latency);
+    EXPECT_LT(speculative_latency, regular_latency);
+    EXPECT_LE(speculative_latency, 1);
+    EXPECT_GE(regular_latency, TAPPING_TERM);
+}
@@ -0,0 +1,121 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "task_profiler.h"
+}
+
+using testing::_;
+
+class TaskProfiler : public TestFixture {
+   public:
+    void SetUp() override {
+        task_profiler_reset();
+    }
+};
+
+TEST_F(TaskProfiler, records_min_avg_max_p99) {
+    for (int i = 0; i < 99; i++) {
+        task_profiler_record(TASK_PROFILER_USER_0, 10);
+    }
+    task_profiler_record(TASK_PROFILER_USER_0, 1000);
+
+    task_profiler_summary_t summary;
+    EXPECT_TRUE(task_profiler_get(TASK_PROFILER_USER_0, &summary));
+    EXPECT_EQ(summary.count, 100);
+    EXPECT_EQ(summary.min, 10);
+    EXPECT_EQ(summary.avg, 19);
+    EXPECT_EQ(summary.max, 1000);
+    /* 10 falls in the 8..15 bin. */
+    EXPECT_EQ(summary.p99, 15);
+}
+
+TEST_F(TaskProfiler, p99_tracks_slow_tail) {
+    for (int i = 0; i < 90; i++) {
+        task_profiler_record(TASK_PROFILER_USER_1, 10);
+    }
+    for (int i = 0; i < 10; i++) {
+        task_profiler_record(TASK_PROFILER_USER_1, 600);
+    }
+
+    task_profiler_summary_t summary;
+    EXPECT_TRUE(task_profiler_get(TASK_PROFILER_USER_1, &summary));
+    EXPECT_EQ(summary.p99, 600);
+}
+
+TEST_F(TaskProfiler, unused_task_is_empty) {
+    task_profiler_summary_t summary;
+    EXPECT_TRUE(task_profiler_get(TASK_PROFILER_USER_3, &summary));
+    EXPECT_EQ(summary.count, 0);
+    EXPECT_EQ(summary.max, 0);
+    EXPECT_FALSE(task_profiler_get(TASK_PROFILER_COUNT, &summary));
+}
+
+TEST_F(TaskProfiler, keyboard_task_stages_are_recorded) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({regular_key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    idle_for(8);
+    VERIFY_AND_CLEAR(driver);
+
+    task_profiler_summary_t matrix, quantum, led;
+    task_profiler_get(TASK_PROFILER_MATRIX, &matrix);
+    task_profiler_get(TASK_PROFILER_QUANTUM, &quantum);
+    task_profiler_get(TASK_PROFILER_LED, &led);
+    EXPECT_EQ(matrix.count, 10);
+    EXPECT_EQ(quantum.count, matrix.count);
+    EXPECT_EQ(led.count, matrix.count);
+}
+
+TEST_F(TaskProfiler, serializes_big_endian_summary) {
+    task_profiler_record(TASK_PROFILER_USER_2, 0x01020304);
+
+    uint8_t data[TASK_PROFILER_SERIALIZED_SIZE] = {0};
+    EXPECT_EQ(task_profiler_serialize(TASK_PROFILER_USER_2, data, sizeof(data)), TASK_PROFILER_SERIALIZED_SIZE);
+    EXPECT_EQ(data[0], TASK_PROFILER_COUNT);
+    /* count */
+    EXPECT_EQ(data[4], 1);
+    /* min */
+    EXPECT_EQ(data[5], 0x01);
+    EXPECT_EQ(data[6], 0x02);
+    EXPECT_EQ(data[7], 0x03);
+    EXPECT_EQ(data[8], 0x04);
+
+    EXPECT_EQ(task_profiler_serialize(TASK_PROFILER_USER_2, data, TASK_PROFILER_SERIALIZED_SIZE - 1), 0);
+    EXPECT_EQ(task_profiler_serialize(TASK_PROFILER_COUNT, data, sizeof(data)), 0);
+}
+
+TEST_F(TaskProfiler, avg_survives_sum_overflow) {
+    for (int i = 0; i < 8; i++) {
+        task_profiler_record(TASK_PROFILER_USER_0, 0x40000000);
+    }
+    task_profiler_record(TASK_PROFILER_USER_0, 0xC0000000);
+
+    task_profiler_summary_t summary;
+    EXPECT_TRUE(task_profiler_get(TASK_PROFILER_USER_0, &summary));
+    EXPECT_EQ(summary.count, 9);
+    EXPECT_EQ(summary.max, 0xC0000000);
+    /* The sum is halved with the sample count, the newest sample weighs more. */
+    EXPECT_GE(summary.avg, 0x40000000);
+    EXPECT_LE(summary.avg, 0xC0000000);
+    EXPECT_EQ(summary.p99, 0xC0000000);
+}
+
+TEST_F(TaskProfiler, avg_over_many_samples) {
+    for (int i = 0; i < 100000; i++) {
+        task_profiler_record(TASK_PROFILER_USER_1, (i & 1) ? 30 : 10);
+    }
+
+    task_profiler_summary_t summary;
+    EXPECT_TRUE(task_profiler_get(TASK_PROFILER_USER_1, &summary));
+    EXPECT_EQ(summary.count, 100000);
+    EXPECT_EQ(summary.avg, 20);
+    EXPECT_EQ(summary.p99, 30);
+}
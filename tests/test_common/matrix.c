@@ -17,21 +17,83 @@
 #include "matrix.h"
 #include "test_matrix.h"
 #include <string.h>
+#ifdef MATRIX_WAKEUP_ENABLE
+#    include "matrix_wakeup.h"
+#endif
+#ifdef KEY_LATENCY_ENABLE
+#    include "timer.h"
+#endif
 
 static matrix_row_t matrix[MATRIX_ROWS] = {};
 
+#ifdef KEY_LATENCY_ENABLE
+// The simulated switch edge happens when the test presses the key, not when it is scanned
+static uint16_t matrix_edge_time[MATRIX_ROWS] = {};
+
+uint16_t matrix_get_edge_time(uint8_t row) {
+    return matrix_edge_time[row];
+}
+
+static void simulate_edge(uint8_t row) {
+    matrix_edge_time[row] = timer_read();
+}
+#else
+static void simulate_edge(uint8_t row) {}
+#endif
+
+#ifdef MATRIX_WAKEUP_ENABLE
+// What the last scan saw, as opposed to the simulated switches in matrix
+static matrix_row_t scanned_matrix[MATRIX_ROWS] = {};
+static bool         wakeup_pins_armed           = false;
+
+void matrix_wakeup_arm_pins(void) {
+    wakeup_pins_armed = true;
+}
+
+void matrix_wakeup_disarm_pins(void) {
+    wakeup_pins_armed = false;
+}
+
+// Only the simulated pin interrupt can wake the matrix
+bool matrix_wakeup_pins_active(void) {
+    return false;
+}
+
+static void simulate_pin_change(void) {
+    if (wakeup_pins_armed) {
+        matrix_wakeup_signal();
+    }
+}
+#else
+static void simulate_pin_change(void) {}
+#endif
+
 void matrix_init(void) {
     clear_all_keys();
     matrix_init_kb();
 }
 
 uint8_t matrix_scan(void) {
+#ifdef MATRIX_WAKEUP_ENABLE
+    if (matrix_wakeup_scan_needed()) {
+        bool active = memcmp(scanned_matrix, matrix, sizeof(matrix)) != 0;
+        memcpy(scanned_matrix, matrix, sizeof(matrix));
+        for (uint8_t row = 0; row < MATRIX_ROWS && !active; row++) {
+            active = matrix[row] != 0;
+        }
+        matrix_wakeup_task(active);
+    }
+#endif
     matrix_scan_kb();
     return 1;
 }
 
 matrix_row_t matrix_get_row(uint8_t row) {
+#ifdef MATRIX_WAKEUP_ENABLE
+    return scanned_matrix[row];
+#else
     return matrix[row];
+#endif
 }
 
 void matrix_print(void) {}
@@ -42,18 +104,23 @@ void matrix_scan_kb(void) {}
 
 void press_key(uint8_t col, uint8_t row) {
     matrix[row] |= (matrix_row_t)1 << col;
+    simulate_edge(row);
+    simulate_pin_change();
 }
 
 void release_key(uint8_t col, uint8_t row) {
     matrix[row] &= ~((matrix_row_t)1 << col);
+    simulate_edge(row);
+    simulate_pin_change();
 }
 
 bool matrix_is_on(uint8_t row, uint8_t col) {
-    return (matrix[row] & ((matrix_row_t)1 << col));
+    return (matrix_get_row(row) & ((matrix_row_t)1 << col));
 }
 
 void clear_all_keys(void) {
     memset(matrix, 0, sizeof(matrix));
+    simulate_pin_change();
 }
 
 void led_set(uint8_t usb_led) {}
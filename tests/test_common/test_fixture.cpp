@@ -104,6 +104,7 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+    resolved_keymap_cache_invalidate();
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -0,0 +1,382 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "trace_replay.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+#include "keycode.h"
+#include "test_matrix.h"
+
+#if defined(__linux__) || defined(__APPLE__)
+#    include <pthread.h>
+#    define TRACE_REPLAY_MEASURE_STACK
+#endif
+
+extern "C" {
+#include "action.h"
+#include "action_tapping.h"
+#include "debug.h"
+#include "host.h"
+#include "keyboard.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+// Time left after the last event for pending timeouts to fire
+constexpr uint32_t replay_settle_ms = TAPPING_TERM * 5;
+
+// Positions of the thumb row keys
+constexpr keypos_t key_lsft = {.col = 0, .row = 3};
+constexpr keypos_t key_spc  = {.col = 4, .row = 3};
+constexpr keypos_t key_ent  = {.col = 5, .row = 3};
+constexpr keypos_t key_quot = {.col = 6, .row = 3};
+constexpr keypos_t key_mins = {.col = 7, .row = 3};
+
+// clang-format off
+constexpr uint16_t qwerty_keycodes[MATRIX_ROWS][MATRIX_COLS] = {
+    {KC_Q,    KC_W,    KC_E,    KC_R,    KC_T,   KC_Y,   KC_U,    KC_I,    KC_O,    KC_P   },
+    {KC_A,    KC_S,    KC_D,    KC_F,    KC_G,   KC_H,   KC_J,    KC_K,    KC_L,    KC_SCLN},
+    {KC_Z,    KC_X,    KC_C,    KC_V,    KC_B,   KC_N,   KC_M,    KC_COMM, KC_DOT,  KC_SLSH},
+    {KC_LSFT, KC_LCTL, KC_LALT, KC_BSPC, KC_SPC, KC_ENT, KC_QUOT, KC_MINS, KC_RSFT, KC_TAB }
+};
+constexpr char qwerty_chars[3][MATRIX_COLS + 1] = {
+    "qwertyuiop",
+    "asdfghjkl;",
+    "zxcvbnm,./",
+};
+// clang-format on
+
+// Built-in typing sample, written to resemble ordinary prose with some
+// capitals and punctuation
+const char* const sample_text =
+    "Keyboards are simple machines at heart. A grid of switches is scanned many times a second, "
+    "and every change of state is turned into a message for the host. Most of the interesting work "
+    "happens between those two points. The firmware has to decide what a press means, whether it is "
+    "part of a chord, whether it should wait for another key, and when it is safe to tell the host.\n"
+    "Each of those decisions costs time. On a small microcontroller the budget for a whole scan is "
+    "often a millisecond or less, and a slow path that only shows up during a fast roll can be hard "
+    "to find by hand. It is much easier to measure it on a desktop first, where the same code can be "
+    "timed with a precise clock and replayed as often as needed.\n"
+    "Fast typists rarely release one key before pressing the next. Their fingers overlap, so the "
+    "matrix sees a stream of rolled presses rather than neat taps. Tap-hold keys, combos and key "
+    "overrides all have to cope with this, and each of them keeps some state while it waits. "
+    "That is exactly where small changes can have surprising effects on latency.\n"
+    "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs. "
+    "How vexingly quick daft zebras jump, said the typist, before typing it all again. "
+    "When the text runs out, the trace ends with every key released, and the keyboard is left to "
+    "settle for a while so that any pending timeouts can fire before the numbers are collected.\n"
+    "None of this replaces testing on real hardware. A desktop processor is far faster than any "
+    "keyboard, and its caches hide costs that matter on a small chip. What it does give is a fair "
+    "comparison between two versions of the same code, run on the same input, one after another. "
+    "If a change makes the numbers worse here, it is very unlikely to make them better on the keyboard.\n";
+
+bool find_char(char c, keypos_t* position, bool* shifted) {
+    *shifted = false;
+    switch (c) {
+        case ' ':
+            *position = key_spc;
+            return true;
+        case '\n':
+            *position = key_ent;
+            return true;
+        case '\'':
+            *position = key_quot;
+            return true;
+        case '-':
+            *position = key_mins;
+            return true;
+    }
+    if (c >= 'A' && c <= 'Z') {
+        *shifted = true;
+        c        = c - 'A' + 'a';
+    }
+    for (uint8_t row = 0; row < 3; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (qwerty_chars[row][col] == c) {
+                *position = {.col = col, .row = row};
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+struct BenchCounters {
+    size_t keyboard_reports;
+    size_t other_reports;
+};
+
+BenchCounters bench_counters = {};
+
+uint8_t bench_keyboard_leds(void) {
+    return 0;
+}
+
+void bench_send_keyboard(report_keyboard_t* report) {
+    bench_counters.keyboard_reports++;
+}
+
+void bench_send_nkro(report_nkro_t* report) {
+    bench_counters.keyboard_reports++;
+}
+
+void bench_send_mouse(report_mouse_t* report) {
+    bench_counters.other_reports++;
+}
+
+void bench_send_extra(report_extra_t* report) {
+    bench_counters.other_reports++;
+}
+
+host_driver_t bench_driver = {bench_keyboard_leds, bench_send_keyboard, bench_send_nkro, bench_send_mouse, bench_send_extra};
+
+struct ReplayContext {
+    const Trace*      trace;
+    TraceReplayStats* stats;
+    uint32_t          duration;
+};
+
+void* replay_scans(void* arg) {
+    auto*             context = static_cast<ReplayContext*>(arg);
+    const Trace&      trace   = *context->trace;
+    TraceReplayStats& stats   = *context->stats;
+
+    const uint32_t start = timer_read32();
+    size_t         next  = 0;
+    for (uint32_t elapsed = 0; elapsed <= context->duration; elapsed = timer_elapsed32(start)) {
+        const size_t first = next;
+        for (; next < trace.size() && trace[next].time <= elapsed; next++) {
+            const TraceEvent& event = trace[next];
+            if (event.pressed) {
+                press_key(event.col, event.row);
+            } else {
+                release_key(event.col, event.row);
+            }
+        }
+
+        const auto scan_start = std::chrono::steady_clock::now();
+        keyboard_task();
+        housekeeping_task();
+        const uint64_t scan_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - scan_start).count();
+
+        stats.scans++;
+        stats.total_ns += scan_ns;
+        if (next != first) {
+            stats.event_scans++;
+            stats.event_ns += scan_ns;
+        }
+        stats.max_scan_ns = std::max(stats.max_scan_ns, scan_ns);
+        advance_time(1);
+    }
+    return nullptr;
+}
+
+#ifdef TRACE_REPLAY_MEASURE_STACK
+void* replay_nothing(void* arg) {
+    return nullptr;
+}
+
+constexpr size_t  replay_stack_size  = 1 << 20;
+constexpr uint8_t replay_stack_paint = 0xA5;
+
+/** Runs `function` on a painted stack and returns how many bytes of it were touched. */
+size_t run_on_painted_stack(void* (*function)(void*), void* arg) {
+    void* stack = nullptr;
+    if (posix_memalign(&stack, 4096, replay_stack_size) != 0) {
+        function(arg);
+        return 0;
+    }
+    memset(stack, replay_stack_paint, replay_stack_size);
+
+    pthread_attr_t attr;
+    pthread_t      thread;
+    pthread_attr_init(&attr);
+    if (pthread_attr_setstack(&attr, stack, replay_stack_size) != 0 || pthread_create(&thread, &attr, function, arg) != 0) {
+        pthread_attr_destroy(&attr);
+        free(stack);
+        function(arg);
+        return 0;
+    }
+    pthread_join(thread, nullptr);
+    pthread_attr_destroy(&attr);
+
+    // The stack grows down from the end of the buffer
+    const uint8_t* bytes     = static_cast<const uint8_t*>(stack);
+    size_t         untouched = 0;
+    while (untouched < replay_stack_size && bytes[untouched] == replay_stack_paint) {
+        untouched++;
+    }
+    free(stack);
+    return replay_stack_size - untouched;
+}
+#endif
+
+} // namespace
+
+Trace load_trace(const std::string& path) {
+    Trace         trace;
+    std::ifstream file(path);
+    if (!file) {
+        ADD_FAILURE() << "could not open trace " << path;
+        return trace;
+    }
+
+    std::string line;
+    for (size_t line_number = 1; std::getline(file, line); line_number++) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        uint32_t           time;
+        unsigned           col, row;
+        char               state;
+        if (!(fields >> time >> col >> row >> state) || col >= MATRIX_COLS || row >= MATRIX_ROWS || (state != 'p' && state != 'r')) {
+            ADD_FAILURE() << path << ":" << line_number << ": malformed trace event '" << line << "'";
+            continue;
+        }
+        if (!trace.empty() && time < trace.back().time) {
+            ADD_FAILURE() << path << ":" << line_number << ": trace event out of time order";
+            continue;
+        }
+        trace.push_back({time, (uint8_t)col, (uint8_t)row, state == 'p'});
+    }
+    return trace;
+}
+
+Trace type_text(const std::string& text, uint32_t seed) {
+    Trace    trace;
+    uint32_t state  = seed;
+    auto     random = [&state](uint32_t range) {
+        state = state * 1103515245 + 12345;
+        return (state >> 16) % range;
+    };
+
+    // Time each key was last released, so that a repeated key is never pressed while still down
+    uint32_t released[MATRIX_ROWS][MATRIX_COLS] = {};
+    uint32_t time                               = 20;
+
+    for (char c : text) {
+        keypos_t position;
+        bool     shifted;
+        if (!find_char(c, &position, &shifted)) {
+            continue;
+        }
+
+        // Roughly 120 words per minute, with holds that often overlap the next press
+        uint32_t press = std::max(time, released[position.row][position.col] + 5);
+        if (shifted) {
+            press = std::max(press, released[key_lsft.row][key_lsft.col] + 20);
+        }
+        const uint32_t release = press + 50 + random(80);
+        trace.push_back({press, position.col, position.row, true});
+        trace.push_back({release, position.col, position.row, false});
+        released[position.row][position.col] = release;
+
+        if (shifted) {
+            trace.push_back({press - 15, key_lsft.col, key_lsft.row, true});
+            trace.push_back({release + 10, key_lsft.col, key_lsft.row, false});
+            released[key_lsft.row][key_lsft.col] = release + 10;
+        }
+        time = press + 40 + random(120);
+    }
+
+    // Releases go before presses that happen in the same millisecond
+    std::stable_sort(trace.begin(), trace.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.time < b.time || (a.time == b.time && !a.pressed && b.pressed); });
+    return trace;
+}
+
+void TraceReplayFixture::set_qwerty_keymap(std::initializer_list<KeymapKey> overrides) {
+    keymap.clear();
+    for (auto& key : overrides) {
+        add_key(key);
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (!find_key(0, {.col = col, .row = row})) {
+                add_key(KeymapKey(0, col, row, qwerty_keycodes[row][col]));
+            }
+        }
+    }
+}
+
+Trace TraceReplayFixture::bench_trace() const {
+    if (const char* path = std::getenv("QMK_BENCH_TRACE")) {
+        return load_trace(path);
+    }
+    return type_text(sample_text);
+}
+
+TraceReplayStats TraceReplayFixture::replay(const Trace& trace) {
+    // Every run, measured or not, covers the trace and the settle time after it
+    const uint32_t   duration = (trace.empty() ? 0 : trace.back().time) + replay_settle_ms;
+    TraceReplayStats stats;
+    ReplayContext    context = {&trace, &stats, duration};
+    stats.events             = trace.size();
+
+    // Debug output would dominate the measurement
+    const uint8_t debug_raw = debug_config.raw;
+    debug_config.raw        = 0;
+    host_set_driver(&bench_driver);
+
+    // Replay once unmeasured, so that caches are warm and lazily bound library
+    // calls are resolved, which would otherwise show up as stalls and stack use
+    TraceReplayStats warmup;
+    ReplayContext    warmup_context = {&trace, &warmup, duration};
+    replay_scans(&warmup_context);
+
+    // Most scans see no event at all, time them on their own so that their
+    // cost can be taken out of the per event figure
+    const Trace      no_events;
+    TraceReplayStats idle;
+    ReplayContext    idle_context = {&no_events, &idle, duration};
+    replay_scans(&idle_context);
+    stats.idle_total_ns = idle.total_ns;
+    stats.idle_scans    = idle.scans;
+    bench_counters      = {};
+
+#ifdef TRACE_REPLAY_MEASURE_STACK
+    // Subtract what the thread itself uses before running anything
+    const size_t baseline = run_on_painted_stack(replay_nothing, nullptr);
+    const size_t used     = run_on_painted_stack(replay_scans, &context);
+    stats.stack_bytes     = used > baseline ? used - baseline : 0;
+#else
+    replay_scans(&context);
+#endif
+
+    host_set_driver(nullptr);
+    debug_config.raw       = debug_raw;
+    stats.keyboard_reports = bench_counters.keyboard_reports;
+    stats.other_reports    = bench_counters.other_reports;
+    return stats;
+}
+
+void TraceReplayFixture::report(const TraceReplayStats& stats) {
+    const ::testing::TestInfo* const test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+
+    std::cout << "[ BENCH    ] " << test_info->test_case_name() << "." << test_info->name() << ": " << stats.events << " events, " << stats.scans << " scans (" << stats.event_scans << " with events), " << std::fixed << std::setprecision(1) << stats.ns_per_event() << " ns/event above idle, " << stats.ns_per_event_scan() << " ns/event scan, " << stats.idle_ns_per_scan() << " ns/idle scan, max stall " << stats.max_scan_ns / 1000.0 << " us, " << stats.keyboard_reports << " keyboard reports, " << stats.other_reports << " other reports";
+#ifdef TRACE_REPLAY_MEASURE_STACK
+    std::cout << ", stack high-water " << stats.stack_bytes << " bytes";
+#endif
+    std::cout << std::endl;
+
+    RecordProperty("events", std::to_string(stats.events));
+    RecordProperty("scans", std::to_string(stats.scans));
+    RecordProperty("event_scans", std::to_string(stats.event_scans));
+    RecordProperty("ns_per_event", std::to_string(stats.ns_per_event()));
+    RecordProperty("ns_per_event_scan", std::to_string(stats.ns_per_event_scan()));
+    RecordProperty("ns_per_idle_scan", std::to_string(stats.idle_ns_per_scan()));
+    RecordProperty("max_stall_ns", std::to_string(stats.max_scan_ns));
+    RecordProperty("keyboard_reports", std::to_string(stats.keyboard_reports));
+    RecordProperty("other_reports", std::to_string(stats.other_reports));
+    RecordProperty("stack_bytes", std::to_string(stats.stack_bytes));
+}
@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "test_fixture.hpp"
+
+/** A single matrix change, `time` milliseconds after the start of the trace. */
+struct TraceEvent {
+    uint32_t time;
+    uint8_t  col;
+    uint8_t  row;
+    bool     pressed;
+};
+
+using Trace = std::vector<TraceEvent>;
+
+/**
+ * @brief Loads a recorded trace.
+ *
+ * The file holds one event per line as `<time_ms> <col> <row> <p|r>`, in time
+ * order. Blank lines and lines starting with `#` are ignored.
+ */
+Trace load_trace(const std::string& path);
+
+/**
+ * @brief Builds a trace of `text` typed on the QWERTY layout of
+ * `TraceReplayFixture::set_qwerty_keymap()`.
+ *
+ * Key timings are drawn from a fixed pseudo-random sequence seeded by `seed`,
+ * so the same text always produces the same trace. Presses regularly overlap
+ * the release of the previous key, as in fast typing.
+ */
+Trace type_text(const std::string& text, uint32_t seed = 1);
+
+struct TraceReplayStats {
+    size_t   events           = 0;
+    size_t   scans            = 0;
+    size_t   event_scans      = 0;
+    uint64_t total_ns         = 0;
+    uint64_t event_ns         = 0;
+    uint64_t idle_total_ns    = 0;
+    size_t   idle_scans       = 0;
+    uint64_t max_scan_ns      = 0;
+    size_t   keyboard_reports = 0;
+    size_t   other_reports    = 0;
+    size_t   stack_bytes      = 0;
+
+    /** Average time of a scan with no keys down, measured in a separate run. */
+    double idle_ns_per_scan() const {
+        return idle_scans ? (double)idle_total_ns / idle_scans : 0;
+    }
+
+    /** Time spent in all scans above the idle baseline, per matrix event. */
+    double ns_per_event() const {
+        if (!events) {
+            return 0;
+        }
+        const double busy_ns = (double)total_ns - idle_ns_per_scan() * scans;
+        return busy_ns > 0 ? busy_ns / events : 0;
+    }
+
+    /** Average time of the scans that picked up at least one matrix event. */
+    double ns_per_event_scan() const {
+        return event_scans ? (double)event_ns / event_scans : 0;
+    }
+};
+
+/**
+ * @brief Fixture that replays matrix traces through `keyboard_task()` and
+ * measures the time spent processing them.
+ */
+class TraceReplayFixture : public TestFixture {
+   public:
+    /**
+     * @brief Maps the test matrix as a 3x10 QWERTY block plus a thumb row, with
+     * `overrides` replacing the keycodes at their positions.
+     */
+    void set_qwerty_keymap(std::initializer_list<KeymapKey> overrides = {});
+
+    /**
+     * @brief Returns the trace named by the `QMK_BENCH_TRACE` environment
+     * variable, or else the built-in typing sample.
+     */
+    Trace bench_trace() const;
+
+    /**
+     * @brief Replays `trace` one scan per millisecond, then idles until the
+     * keyboard has settled.
+     *
+     * The trace is replayed twice and only the second run is measured, so it
+     * should end with every key released. The idle baseline is taken from a
+     * run of the same length without any events.
+     */
+    TraceReplayStats replay(const Trace& trace);
+
+    /** @brief Prints `stats` and records them as test properties. */
+    void report(const TraceReplayStats& stats);
+};
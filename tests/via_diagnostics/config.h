@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TRANSIENT_EEPROM_SIZE 1024
+#define DYNAMIC_KEYMAP_EEPROM_ADDR 256
@@ -0,0 +1,11 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+VIA_ENABLE = yes
+TASK_PROFILER_ENABLE = yes
+KEY_LATENCY_ENABLE = yes
+EEPROM_DRIVER = transient
@@ -0,0 +1,60 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "raw_hid.h"
+#include "via.h"
+#include "task_profiler.h"
+#include "key_latency.h"
+}
+
+class ViaDiagnostics : public TestFixture {
+   public:
+    // The responses are sent through the host driver
+    TestDriver driver;
+};
+
+TEST_F(ViaDiagnostics, task_profiler_channel_reads_and_resets) {
+    task_profiler_reset();
+    task_profiler_record(TASK_PROFILER_USER_0, 0x01020304);
+
+    uint8_t data[32] = {id_custom_get_value, id_qmk_task_profiler_channel, id_qmk_task_profiler_stats, TASK_PROFILER_USER_0};
+    raw_hid_receive(data, sizeof(data));
+    EXPECT_EQ(data[0], id_custom_get_value);
+    EXPECT_EQ(data[4], TASK_PROFILER_COUNT);
+    // The count, then the minimum
+    EXPECT_EQ(data[8], 1);
+    EXPECT_EQ(data[9], 0x01);
+    EXPECT_EQ(data[12], 0x04);
+
+    uint8_t reset[32] = {id_custom_set_value, id_qmk_task_profiler_channel, id_qmk_task_profiler_stats};
+    raw_hid_receive(reset, sizeof(reset));
+    EXPECT_EQ(reset[0], id_custom_set_value);
+
+    task_profiler_summary_t summary;
+    task_profiler_get(TASK_PROFILER_USER_0, &summary);
+    EXPECT_EQ(summary.count, 0);
+}
+
+TEST_F(ViaDiagnostics, key_latency_channel_reads_and_resets) {
+    uint8_t data[32] = {id_custom_get_value, id_qmk_key_latency_channel, id_qmk_key_latency_stats, 0};
+    raw_hid_receive(data, sizeof(data));
+    EXPECT_EQ(data[0], id_custom_get_value);
+    EXPECT_EQ(data[4], KEY_LATENCY_BUCKETS);
+
+    uint8_t reset[32] = {id_custom_set_value, id_qmk_key_latency_channel, id_qmk_key_latency_stats};
+    raw_hid_receive(reset, sizeof(reset));
+    EXPECT_EQ(reset[0], id_custom_set_value);
+}
+
+TEST_F(ViaDiagnostics, unknown_values_are_unhandled) {
+    uint8_t data[32] = {id_custom_get_value, id_qmk_task_profiler_channel, 0x7F, 0};
+    raw_hid_receive(data, sizeof(data));
+    EXPECT_EQ(data[0], id_unhandled);
+
+    uint8_t out_of_range[32] = {id_custom_get_value, id_qmk_task_profiler_channel, id_qmk_task_profiler_stats, TASK_PROFILER_COUNT};
+    raw_hid_receive(out_of_range, sizeof(out_of_range));
+    EXPECT_EQ(out_of_range[0], id_unhandled);
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Normally generated by the keyboard build
+#define QMK_VERSION "test"
+#define QMK_BUILDDATE "2026-01-01-00:00:00"
+#define QMK_GIT_HASH "test"
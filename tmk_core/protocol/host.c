@@ -35,6 +35,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "connection.h"
 #endif
 
+#ifdef KEY_LATENCY_ENABLE
+#    include "key_latency.h"
+#endif
+
+#ifdef COALESCE_KEYBOARD_REPORTS
+#    include "action_util.h"
+#endif
+
 #ifdef BLUETOOTH_ENABLE
 #    include "bluetooth.h"
 
@@ -142,6 +150,9 @@ void host_keyboard_send(report_keyboard_t *report) {
     report->report_id = REPORT_ID_KEYBOARD;
 #endif
     (*driver->send_keyboard)(report);
+#ifdef KEY_LATENCY_ENABLE
+    key_latency_report_sent();
+#endif
 
     if (debug_keyboard) {
         dprintf("keyboard_report: %02X | ", report->mods);
@@ -158,6 +169,9 @@ void host_nkro_send(report_nkro_t *report) {
 
     report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
+#ifdef KEY_LATENCY_ENABLE
+    key_latency_report_sent();
+#endif
 
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);
@@ -169,6 +183,11 @@ void host_nkro_send(report_nkro_t *report) {
 }
 
 void host_mouse_send(report_mouse_t *report) {
+#ifdef COALESCE_KEYBOARD_REPORTS
+    // A held back keyboard report describes an earlier state, so the host must see it first
+    flush_keyboard_report();
+#endif
+
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_mouse) return;
 
@@ -184,6 +203,10 @@ void host_mouse_send(report_mouse_t *report) {
 }
 
 void host_system_send(uint16_t usage) {
+#ifdef COALESCE_KEYBOARD_REPORTS
+    flush_keyboard_report();
+#endif
+
     if (usage == last_system_usage) return;
     last_system_usage = usage;
 
@@ -198,6 +221,10 @@ void host_system_send(uint16_t usage) {
 }
 
 void host_consumer_send(uint16_t usage) {
+#ifdef COALESCE_KEYBOARD_REPORTS
+    flush_keyboard_report();
+#endif
+
     if (usage == last_consumer_usage) return;
     last_consumer_usage = usage;
 